@@ -12,6 +12,7 @@
 
 #import <React/RCTFabricComponentsPlugins.h>
 #import "RNDateTimePicker.h"
+#import "RNDateTimePickerMeasurementService.h"
 
 using namespace facebook::react;
 
@@ -36,31 +37,31 @@ NSDate* adjustMinimumDate (NSDate* minimumDate, int minuteInterval) {
                                                   options:0];
 }
 
+static const Props::Shared &defaultPickerProps (void) {
+    static const Props::Shared defaultProps = std::make_shared<const RNDateTimePickerProps>();
+    return defaultProps;
+}
+
 @interface RNDateTimePickerComponentView () <RCTRNDateTimePickerViewProtocol>
 @end
 
 @implementation RNDateTimePickerComponentView {
     UIDatePicker *_picker;
-    // Dummy picker to apply prop changes and calculate/update the size before the actual picker gets updated
-    UIDatePicker *_dummyPicker;
     RNDateTimePickerShadowNode::ConcreteState::Shared _state;
 }
 
 - (instancetype)initWithFrame:(CGRect)frame
 {
     if (self = [super initWithFrame:frame]) {
-        static const auto defaultProps = std::make_shared<const RNDateTimePickerProps>();
-        _props = defaultProps;
+        _props = defaultPickerProps();
 
         _picker = [RNDateTimePicker new];
-        _dummyPicker = [RNDateTimePicker new];
 
         [_picker addTarget:self action:@selector(onChange:) forControlEvents:UIControlEventValueChanged];
         [_picker addTarget:self action:@selector(onDismiss:) forControlEvents:UIControlEventEditingDidEnd];
 
         // Default Picker mode
         _picker.datePickerMode = UIDatePickerModeDate;
-        _dummyPicker.datePickerMode = UIDatePickerModeDate;
 
         self.contentView = _picker;
     }
@@ -95,29 +96,60 @@ NSDate* adjustMinimumDate (NSDate* minimumDate, int minuteInterval) {
 }
 
 /**
- * Updates the shadow node state with the dummyPicker size. This will update the shadow node size.
+ * Updates the shadow node state with the measured picker size. This will update the shadow node size.
  * (see adopt method in ComponentDescriptors.h)
+ * Sizes come from the shared measurement service, so views never measure their own picker.
  */
-- (void) updateMeasurements {
+- (void) updateMeasurementsForProps:(const RNDateTimePickerProps &)props {
     if (_state == nullptr) {
         return;
     }
-    CGSize size = [_dummyPicker sizeThatFits:UILayoutFittingCompressedSize];
-    size.width += 10;
-    auto newState = RNDateTimePickerState{RCTSizeFromCGSize(size)};
-    _state->updateState(std::move(newState));
+    updateFrameSize(*_state, [[RNDateTimePickerMeasurementService sharedService] sizeForProps:props]);
 }
 
 #pragma mark - RCTComponentViewProtocol
 
 + (ComponentDescriptorProvider)componentDescriptorProvider
 {
+    [[RNDateTimePickerMeasurementService sharedService] loadPersistedMeasurements];
     return concreteComponentDescriptorProvider<RNDateTimePickerComponentDescriptor>();
 }
 
-+ (BOOL)shouldBeRecycled
+- (void)prepareForRecycle
 {
-  return NO;
+    // The next mount only applies what differs from the default props, so the picker must be exactly as
+    // initWithFrame: left it. Diffing back to the default props does not get there: a zero
+    // timeZoneOffsetInMinutes, for one, would pin the picker to GMT instead of the local time zone.
+    [self resetPicker:_picker];
+    _props = defaultPickerProps();
+    _state.reset();
+
+    [super prepareForRecycle];
+}
+
+/**
+ * Returns every property that updatePropsForPicker may set to the value of a newly created picker.
+ */
+- (void)resetPicker:(UIDatePicker *)picker
+{
+    // Before the style changes, as only the wheels style takes a custom text color
+    [self updateTextColorForPicker:picker color:nil];
+
+    picker.datePickerMode = UIDatePickerModeDate;
+    if (@available(iOS 14.0, *)) {
+        picker.preferredDatePickerStyle = UIDatePickerStyleAutomatic;
+    }
+    picker.locale = nil;
+    picker.timeZone = NSTimeZone.localTimeZone;
+    picker.minimumDate = nil;
+    picker.maximumDate = nil;
+    picker.minuteInterval = 1;
+    picker.date = [NSDate date];
+    picker.tintColor = nil;
+    if (@available(iOS 13.0, *)) {
+        picker.overrideUserInterfaceStyle = UIUserInterfaceStyleUnspecified;
+    }
+    picker.enabled = YES;
 }
 
 -(void)updateTextColorForPicker:(UIDatePicker *)picker color:(UIColor *)color
@@ -152,14 +184,13 @@ NSDate* adjustMinimumDate (NSDate* minimumDate, int minuteInterval) {
 
     if (oldState == nullptr) {
         // Calculate the initial picker measurements
-        [self updateMeasurements];
+        [self updateMeasurementsForProps:*std::static_pointer_cast<const RNDateTimePickerProps>(_props)];
     }
 }
 
 /**
  * Updates picker properties based on prop changes and returns a boolean that indicates if the shadow node size needs
- * to be updated. This boolean helpful when we update the dummy picker to know if we need to update the shadow node
- * size before updating the actual picker.
+ * to be updated.
  * Props that will to update measurements: date, locale, mode, displayIOS.
  */
 - (Boolean)updatePropsForPicker:(UIDatePicker *)picker props:(Props::Shared const &)props oldProps:(Props::Shared const &)oldProps {
@@ -308,15 +339,12 @@ NSDate* adjustMinimumDate (NSDate* minimumDate, int minuteInterval) {
 
 - (void)updateProps:(Props::Shared const &)props oldProps:(Props::Shared const &)oldProps
 {
-    // Updating the dummy first to check if we need to update measurements
-    Boolean needsToUpdateMeasurements = [self updatePropsForPicker:_dummyPicker props:props oldProps:oldProps];
+    Boolean needsToUpdateMeasurements = [self updatePropsForPicker:_picker props:props oldProps:oldProps];
 
     if (needsToUpdateMeasurements) {
-        [self updateMeasurements];
+        [self updateMeasurementsForProps:*std::static_pointer_cast<const RNDateTimePickerProps>(props)];
     }
 
-    [self updatePropsForPicker:_picker props:props oldProps:oldProps];
-
     [super updateProps:props oldProps:oldProps];
 }
 
@@ -0,0 +1,33 @@
+/**
+ * RNDateTimePickerMeasurementService is only be available when fabric is enabled.
+ *
+ * Measures picker sizes for all RNDateTimePickerComponentView instances with one shared, offscreen
+ * UIDatePicker, backed by the C++ measurement cache (see cpp/.../RNDateTimePickerMeasurementCache.h).
+ * Must be used from the main thread.
+ */
+
+#import <Foundation/Foundation.h>
+
+#import <react/renderer/components/RNDateTimePickerCGen/Props.h>
+#import <react/renderer/graphics/Geometry.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface RNDateTimePickerMeasurementService : NSObject
+
++ (instancetype)sharedService;
+
+/**
+ * Starts loading sizes persisted by previous launches on a background queue. Only the first call has an effect.
+ */
+- (void)loadPersistedMeasurements;
+
+/**
+ * Returns the frame size of a picker with the given props, measuring it only if no picker with the
+ * same configuration has been measured before.
+ */
+- (facebook::react::Size)sizeForProps:(const facebook::react::RNDateTimePickerProps &)props;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,263 @@
+/**
+ * RNDateTimePickerMeasurementService is only be available when fabric is enabled.
+ */
+
+#import "RNDateTimePickerMeasurementService.h"
+#import <React/RCTConversions.h>
+
+#import "cpp/react/renderer/components/RNDateTimePicker/RNDateTimePickerMeasurementCache.h"
+#import "cpp/react/renderer/components/RNDateTimePicker/RNDateTimePickerMeasurementStore.h"
+#import "RNDateTimePicker.h"
+
+#import <atomic>
+
+using namespace facebook::react;
+
+// Measured sizes are persisted in the caches directory so the next launch can skip measuring
+static dispatch_queue_t measurementStoreQueue (void) {
+    static dispatch_queue_t queue;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        queue = dispatch_queue_create("com.reactcommunity.datetimepicker.measurements", DISPATCH_QUEUE_SERIAL);
+    });
+    return queue;
+}
+
+static std::string measurementStorePath (void) {
+    NSString *cachesDirectory = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+    return RCTStringFromNSString([cachesDirectory stringByAppendingPathComponent:@"RNDateTimePickerMeasurements.bin"]);
+}
+
+static std::string measurementStoreOSVersion (void) {
+    return RCTStringFromNSString(NSProcessInfo.processInfo.operatingSystemVersionString);
+}
+
+static uint64_t savedMeasurementRevision = 0;
+
+// Coalesces the writes caused by a burst of new measurements into one
+static void schedulePersistMeasurements (void) {
+    static std::atomic<bool> scheduled{false};
+    if (scheduled.exchange(true)) {
+        return;
+    }
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, 2 * NSEC_PER_SEC), measurementStoreQueue(), ^{
+        scheduled = false;
+        auto &cache = RNDateTimePickerMeasurementCache::shared();
+        uint64_t revision = cache.revision();
+        if (revision == savedMeasurementRevision) {
+            return;
+        }
+        auto data = RNDateTimePickerMeasurementStore::encode(cache.snapshot(), measurementStoreOSVersion());
+        if (RNDateTimePickerMeasurementStore::save(measurementStorePath(), data)) {
+            savedMeasurementRevision = revision;
+        }
+    });
+}
+
+static NSLocale *localeForProps (const RNDateTimePickerProps &props) {
+    if (props.locale.empty()) {
+        return NSLocale.currentLocale;
+    }
+    return [[NSLocale alloc] initWithLocaleIdentifier:RCTNSStringFromString(props.locale)];
+}
+
+// Mirrors how the component view applies timeZoneOffsetInMinutes and timeZoneName to its picker
+static NSTimeZone *timeZoneForProps (const RNDateTimePickerProps &props) {
+    if (!props.timeZoneName.empty()) {
+        return [NSTimeZone timeZoneWithName:RCTNSStringFromString(props.timeZoneName)] ?: NSTimeZone.localTimeZone;
+    }
+    if (props.timeZoneOffsetInMinutes != 0) {
+        return [NSTimeZone timeZoneForSecondsFromGMT:props.timeZoneOffsetInMinutes * 60.0];
+    }
+    return NSTimeZone.localTimeZone;
+}
+
+@implementation RNDateTimePickerMeasurementService {
+    // Offscreen picker configured from the props being measured; replaces one dummy picker per view
+    UIDatePicker *_measuringPicker;
+    // Per locale prop (empty for the current locale); dropped when the user changes the current locale
+    NSMutableDictionary<NSString *, NSLocale *> *_locales;
+    NSMutableDictionary<NSString *, NSNumber *> *_is24HourByLocale;
+    // Per locale prop and mode; the time zone is set on each use
+    NSMutableDictionary<NSString *, NSDateFormatter *> *_compactFormatters;
+}
+
++ (instancetype)sharedService
+{
+    static RNDateTimePickerMeasurementService *service;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        service = [RNDateTimePickerMeasurementService new];
+    });
+    return service;
+}
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        _locales = [NSMutableDictionary new];
+        _is24HourByLocale = [NSMutableDictionary new];
+        _compactFormatters = [NSMutableDictionary new];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(currentLocaleDidChange:)
+                                                     name:NSCurrentLocaleDidChangeNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+- (void)currentLocaleDidChange:(NSNotification *)notification
+{
+    // Posted on the thread that changed the locale; the caches are only used on the main thread
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [self->_locales removeAllObjects];
+        [self->_is24HourByLocale removeAllObjects];
+        [self->_compactFormatters removeAllObjects];
+    });
+}
+
+- (NSLocale *)localeForProps:(const RNDateTimePickerProps &)props
+{
+    NSString *localeProp = RCTNSStringFromString(props.locale);
+    NSLocale *locale = _locales[localeProp];
+    if (locale == nil) {
+        locale = localeForProps(props);
+        _locales[localeProp] = locale;
+    }
+    return locale;
+}
+
+- (BOOL)is24HourForProps:(const RNDateTimePickerProps &)props locale:(NSLocale *)locale
+{
+    NSString *localeProp = RCTNSStringFromString(props.locale);
+    NSNumber *is24Hour = _is24HourByLocale[localeProp];
+    if (is24Hour == nil) {
+        NSString *hourFormat = [NSDateFormatter dateFormatFromTemplate:@"j" options:0 locale:locale];
+        is24Hour = @([hourFormat rangeOfString:@"a"].location == NSNotFound);
+        _is24HourByLocale[localeProp] = is24Hour;
+    }
+    return is24Hour.boolValue;
+}
+
+- (NSDateFormatter *)compactFormatterForProps:(const RNDateTimePickerProps &)props locale:(NSLocale *)locale
+{
+    NSString *formatterKey = [NSString stringWithFormat:@"%@|%d", RCTNSStringFromString(props.locale), static_cast<int>(props.mode)];
+    NSDateFormatter *formatter = _compactFormatters[formatterKey];
+    if (formatter == nil) {
+        formatter = [NSDateFormatter new];
+        formatter.locale = locale;
+        formatter.dateStyle = props.mode == RNDateTimePickerMode::Time ? NSDateFormatterNoStyle : NSDateFormatterMediumStyle;
+        formatter.timeStyle = props.mode == RNDateTimePickerMode::Date ? NSDateFormatterNoStyle : NSDateFormatterShortStyle;
+        _compactFormatters[formatterKey] = formatter;
+    }
+    formatter.timeZone = timeZoneForProps(props);
+    return formatter;
+}
+
+- (void)loadPersistedMeasurements
+{
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        dispatch_async(measurementStoreQueue(), ^{
+            auto &cache = RNDateTimePickerMeasurementCache::shared();
+            cache.restore(RNDateTimePickerMeasurementStore::load(measurementStorePath(), measurementStoreOSVersion()));
+            savedMeasurementRevision = cache.revision();
+        });
+    });
+}
+
+/**
+ * Builds the measurement cache key for the given props. Pickers with the same key have the same intrinsic size.
+ * The compact style renders the selected value as text, so its key also includes that text.
+ */
+- (RNDateTimePickerMeasurementKey)measurementKeyForProps:(const RNDateTimePickerProps &)props
+{
+    NSLocale *locale = [self localeForProps:props];
+
+    RNDateTimePickerMeasurementKey key;
+    key.mode = static_cast<int>(props.mode);
+    key.display = static_cast<int>(props.displayIOS);
+    key.locale = RCTStringFromNSString(locale.localeIdentifier);
+    key.fontScale = [[UIFontMetrics defaultMetrics] scaledValueForValue:1.0];
+    key.is24Hour = [self is24HourForProps:props locale:locale];
+
+    if (props.displayIOS == RNDateTimePickerDisplayIOS::Compact) {
+        NSDateFormatter *formatter = [self compactFormatterForProps:props locale:locale];
+        NSDate *date = [NSDate dateWithTimeIntervalSince1970:props.date / 1000.0];
+        key.locale += "|" + RCTStringFromNSString([formatter stringFromDate:date]);
+    }
+    return key;
+}
+
+/**
+ * Applies every prop that affects the picker size. The measuring picker is shared, so nothing can be
+ * assumed about its previous configuration.
+ */
+- (void)configureMeasuringPickerForProps:(const RNDateTimePickerProps &)props
+{
+    if (_measuringPicker == nil) {
+        _measuringPicker = [RNDateTimePicker new];
+    }
+
+    switch(props.mode) {
+        case RNDateTimePickerMode::Time:
+            _measuringPicker.datePickerMode = UIDatePickerModeTime;
+            break;
+        case RNDateTimePickerMode::Datetime:
+            _measuringPicker.datePickerMode = UIDatePickerModeDateAndTime;
+            break;
+        case RNDateTimePickerMode::Countdown:
+            _measuringPicker.datePickerMode = UIDatePickerModeCountDownTimer;
+            break;
+        default:
+            _measuringPicker.datePickerMode = UIDatePickerModeDate;
+    }
+
+    if (@available(iOS 14.0, *)) {
+        switch(props.displayIOS) {
+            case RNDateTimePickerDisplayIOS::Compact:
+                _measuringPicker.preferredDatePickerStyle = UIDatePickerStyleCompact;
+                break;
+            case RNDateTimePickerDisplayIOS::Inline:
+                _measuringPicker.preferredDatePickerStyle = UIDatePickerStyleInline;
+                break;
+            case RNDateTimePickerDisplayIOS::Spinner:
+                _measuringPicker.preferredDatePickerStyle = UIDatePickerStyleWheels;
+                break;
+            default:
+                _measuringPicker.preferredDatePickerStyle = UIDatePickerStyleAutomatic;
+        }
+    }
+
+    _measuringPicker.locale = [self localeForProps:props];
+    _measuringPicker.timeZone = timeZoneForProps(props);
+    _measuringPicker.minimumDate = nil;
+    _measuringPicker.maximumDate = nil;
+    _measuringPicker.date = [NSDate dateWithTimeIntervalSince1970:props.date / 1000.0];
+}
+
+- (Size)sizeForProps:(const RNDateTimePickerProps &)props
+{
+    auto &cache = RNDateTimePickerMeasurementCache::shared();
+    auto key = [self measurementKeyForProps:props];
+    Size frameSize;
+    if (auto cachedSize = cache.get(key)) {
+        frameSize = *cachedSize;
+    } else {
+        [self configureMeasuringPickerForProps:props];
+        CGSize size = [_measuringPicker sizeThatFits:UILayoutFittingCompressedSize];
+        size.width += 10;
+        frameSize = RCTSizeFromCGSize(size);
+        cache.set(key, frameSize);
+        schedulePersistMeasurements();
+    }
+
+    // Lets the shadow node size the next picker with these props correctly on its first layout. It
+    // looks the size up by the locale prop, not the resolved locale and compact text.
+    auto intrinsicKey = key;
+    intrinsicKey.locale = props.locale;
+    cache.setIntrinsicSize(intrinsicKey, frameSize);
+    return frameSize;
+}
+
+@end
@@ -0,0 +1,109 @@
+/**
+ * Process-wide cache of measured picker frame sizes.
+ */
+
+#include "RNDateTimePickerMeasurementCache.h"
+
+#include <iterator>
+
+namespace facebook {
+namespace react {
+
+RNDateTimePickerMeasurementCache::RNDateTimePickerMeasurementCache(size_t capacity)
+    : capacity_(capacity > 0 ? capacity : 1) {}
+
+RNDateTimePickerMeasurementCache &RNDateTimePickerMeasurementCache::shared() {
+    static RNDateTimePickerMeasurementCache cache;
+    return cache;
+}
+
+std::optional<Size> RNDateTimePickerMeasurementCache::get(const RNDateTimePickerMeasurementKey &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return std::nullopt;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+}
+
+void RNDateTimePickerMeasurementCache::set(const RNDateTimePickerMeasurementKey &key, Size size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        if (it->second->second != size) {
+            it->second->second = size;
+            ++revision_;
+        }
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+
+    if (entries_.size() >= capacity_) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    entries_.emplace_front(key, size);
+    index_[key] = entries_.begin();
+    ++revision_;
+}
+
+std::vector<std::pair<RNDateTimePickerMeasurementKey, Size>> RNDateTimePickerMeasurementCache::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {entries_.begin(), entries_.end()};
+}
+
+void RNDateTimePickerMeasurementCache::restore(const std::vector<std::pair<RNDateTimePickerMeasurementKey, Size>> &entries) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &[key, size] : entries) {
+        if (entries_.size() >= capacity_) {
+            break;
+        }
+        if (index_.find(key) == index_.end()) {
+            entries_.emplace_back(key, size);
+            index_[key] = std::prev(entries_.end());
+        }
+    }
+}
+
+uint64_t RNDateTimePickerMeasurementCache::revision() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return revision_;
+}
+
+std::optional<Size> RNDateTimePickerMeasurementCache::intrinsicSize(int mode, int display, const std::string &locale) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RNDateTimePickerMeasurementKey key{mode, display, locale, fontScale_};
+    if (auto is24Hour = is24HourByLocale_.find(locale); is24Hour != is24HourByLocale_.end()) {
+        key.is24Hour = is24Hour->second;
+    }
+    auto it = intrinsicSizes_.find(key);
+    if (it == intrinsicSizes_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void RNDateTimePickerMeasurementCache::setIntrinsicSize(const RNDateTimePickerMeasurementKey &key, Size size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    intrinsicSizes_[key] = size;
+    fontScale_ = key.fontScale;
+    is24HourByLocale_[key.locale] = key.is24Hour;
+}
+
+void RNDateTimePickerMeasurementCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    intrinsicSizes_.clear();
+    fontScale_ = 1;
+    is24HourByLocale_.clear();
+}
+
+size_t RNDateTimePickerMeasurementCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,117 @@
+/**
+ * Process-wide cache of measured picker frame sizes. Pickers that share the same mode, display,
+ * locale, font scale and clock format have the same intrinsic size, so only the first one needs
+ * to be measured with UIKit. It also keeps the intrinsic size table the shadow node measures with.
+ */
+
+#pragma once
+
+#include <react/renderer/graphics/Geometry.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+struct RNDateTimePickerMeasurementKey {
+    int mode{0};
+    int display{0};
+    std::string locale{};
+    Float fontScale{1};
+    bool is24Hour{false};
+
+    bool operator==(const RNDateTimePickerMeasurementKey &other) const {
+        return mode == other.mode && display == other.display && locale == other.locale &&
+            fontScale == other.fontScale && is24Hour == other.is24Hour;
+    }
+};
+
+struct RNDateTimePickerMeasurementKeyHash {
+    size_t operator()(const RNDateTimePickerMeasurementKey &key) const {
+        size_t hash = std::hash<std::string>{}(key.locale);
+        hash = hash * 31 + std::hash<int>{}(key.mode);
+        hash = hash * 31 + std::hash<int>{}(key.display);
+        hash = hash * 31 + std::hash<Float>{}(key.fontScale);
+        hash = hash * 31 + (key.is24Hour ? 1 : 0);
+        return hash;
+    }
+};
+
+/*
+ * Thread-safe LRU cache from measurement key to frame size.
+ */
+class RNDateTimePickerMeasurementCache final {
+  public:
+    static constexpr size_t kDefaultCapacity = 32;
+
+    explicit RNDateTimePickerMeasurementCache(size_t capacity = kDefaultCapacity);
+
+    static RNDateTimePickerMeasurementCache &shared();
+
+    /*
+     * Returns the cached size and marks the entry as most recently used.
+     */
+    std::optional<Size> get(const RNDateTimePickerMeasurementKey &key);
+
+    /*
+     * Stores a measured size, evicting the least recently used entry when full.
+     */
+    void set(const RNDateTimePickerMeasurementKey &key, Size size);
+
+    /*
+     * Intrinsic size table used by the shadow node before the native view has measured. Keyed like
+     * the measured sizes, but with the locale prop as set from JS. The shadow node only knows the
+     * props, so the lookup completes the key with the font scale and clock format the native view
+     * last reported for that locale prop.
+     */
+    std::optional<Size> intrinsicSize(int mode, int display, const std::string &locale) const;
+
+    /*
+     * Stores the size of a measured picker and records its font scale and clock format for later
+     * lookups. The native view calls it whenever it measures a picker.
+     */
+    void setIntrinsicSize(const RNDateTimePickerMeasurementKey &key, Size size);
+
+    /*
+     * Entries from most to least recently used, for persisting to disk.
+     */
+    std::vector<std::pair<RNDateTimePickerMeasurementKey, Size>> snapshot() const;
+
+    /*
+     * Adds persisted entries behind the ones already measured in this process, which take precedence.
+     */
+    void restore(const std::vector<std::pair<RNDateTimePickerMeasurementKey, Size>> &entries);
+
+    /*
+     * Increases whenever set() stores a new or changed size.
+     */
+    uint64_t revision() const;
+
+    void clear();
+    size_t size() const;
+    size_t capacity() const { return capacity_; }
+
+  private:
+    using Entry = std::pair<RNDateTimePickerMeasurementKey, Size>;
+
+    const size_t capacity_;
+    mutable std::mutex mutex_;
+    uint64_t revision_{0};
+    std::list<Entry> entries_;
+    std::unordered_map<RNDateTimePickerMeasurementKey, std::list<Entry>::iterator, RNDateTimePickerMeasurementKeyHash> index_;
+    std::unordered_map<RNDateTimePickerMeasurementKey, Size, RNDateTimePickerMeasurementKeyHash> intrinsicSizes_;
+    Float fontScale_{1};
+    std::unordered_map<std::string, bool> is24HourByLocale_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,190 @@
+/**
+ * On-disk format for the picker measurement cache.
+ *
+ * Layout (little-endian):
+ *   u32 magic, u32 format version, u16 OS version length, OS version bytes, u32 entry count,
+ *   entries of { i32 mode, i32 display, f32 font scale, u8 is24Hour, u16 locale length, locale bytes,
+ *   f32 width, f32 height }, u32 FNV-1a checksum of everything before it.
+ */
+
+#include "RNDateTimePickerMeasurementStore.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+constexpr size_t kMaxStringLength = 0xFFFF;
+
+uint32_t checksum(const uint8_t *data, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+class Writer {
+  public:
+    template <typename T>
+    void write(T value) {
+        uint8_t bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        buffer_.insert(buffer_.end(), bytes, bytes + sizeof(T));
+    }
+
+    void writeString(const std::string &value) {
+        auto length = std::min(value.size(), kMaxStringLength);
+        write(static_cast<uint16_t>(length));
+        buffer_.insert(buffer_.end(), value.begin(), value.begin() + length);
+    }
+
+    std::vector<uint8_t> finish() {
+        write(checksum(buffer_.data(), buffer_.size()));
+        return std::move(buffer_);
+    }
+
+  private:
+    std::vector<uint8_t> buffer_;
+};
+
+class Reader {
+  public:
+    Reader(const uint8_t *data, size_t length) : data_(data), length_(length) {}
+
+    template <typename T>
+    bool read(T &value) {
+        if (length_ - offset_ < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, data_ + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string &value) {
+        uint16_t length = 0;
+        if (!read(length) || length_ - offset_ < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char *>(data_ + offset_), length);
+        offset_ += length;
+        return true;
+    }
+
+    bool atEnd() const { return offset_ == length_; }
+
+  private:
+    const uint8_t *data_;
+    size_t length_;
+    size_t offset_{0};
+};
+
+} // namespace
+
+std::vector<uint8_t> RNDateTimePickerMeasurementStore::encode(const Entries &entries, const std::string &osVersion) {
+    Writer writer;
+    writer.write(kMagic);
+    writer.write(kFormatVersion);
+    writer.writeString(osVersion);
+    writer.write(static_cast<uint32_t>(entries.size()));
+    for (const auto &[key, size] : entries) {
+        writer.write(static_cast<int32_t>(key.mode));
+        writer.write(static_cast<int32_t>(key.display));
+        writer.write(static_cast<float>(key.fontScale));
+        writer.write(static_cast<uint8_t>(key.is24Hour ? 1 : 0));
+        writer.writeString(key.locale);
+        writer.write(static_cast<float>(size.width));
+        writer.write(static_cast<float>(size.height));
+    }
+    return writer.finish();
+}
+
+RNDateTimePickerMeasurementStore::Entries RNDateTimePickerMeasurementStore::decode(const uint8_t *data, size_t length, const std::string &osVersion) {
+    uint32_t storedChecksum = 0;
+    if (data == nullptr || length < sizeof(storedChecksum)) {
+        return {};
+    }
+    const size_t payloadLength = length - sizeof(storedChecksum);
+    std::memcpy(&storedChecksum, data + payloadLength, sizeof(storedChecksum));
+    if (storedChecksum != checksum(data, payloadLength)) {
+        return {};
+    }
+
+    Reader reader(data, payloadLength);
+    uint32_t magic = 0;
+    uint32_t formatVersion = 0;
+    std::string storedOsVersion;
+    uint32_t count = 0;
+    if (!reader.read(magic) || magic != kMagic || !reader.read(formatVersion) || formatVersion != kFormatVersion ||
+        !reader.readString(storedOsVersion) || storedOsVersion != osVersion || !reader.read(count)) {
+        return {};
+    }
+
+    Entries entries;
+    for (uint32_t i = 0; i < count; ++i) {
+        int32_t mode = 0;
+        int32_t display = 0;
+        float fontScale = 0;
+        uint8_t is24Hour = 0;
+        RNDateTimePickerMeasurementKey key;
+        float width = 0;
+        float height = 0;
+        if (!reader.read(mode) || !reader.read(display) || !reader.read(fontScale) || !reader.read(is24Hour) ||
+            !reader.readString(key.locale) || !reader.read(width) || !reader.read(height)) {
+            return {};
+        }
+        key.mode = mode;
+        key.display = display;
+        key.fontScale = fontScale;
+        key.is24Hour = is24Hour != 0;
+        entries.emplace_back(std::move(key), Size{width, height});
+    }
+    return reader.atEnd() ? entries : Entries{};
+}
+
+RNDateTimePickerMeasurementStore::Entries RNDateTimePickerMeasurementStore::load(const std::string &path, const std::string &osVersion) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return {};
+    }
+
+    Entries entries;
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+        auto length = static_cast<size_t>(info.st_size);
+        void *mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            entries = decode(static_cast<const uint8_t *>(mapped), length, osVersion);
+            ::munmap(mapped, length);
+        }
+    }
+    ::close(fd);
+    return entries;
+}
+
+bool RNDateTimePickerMeasurementStore::save(const std::string &path, const std::vector<uint8_t> &data) {
+    const std::string temporaryPath = path + ".tmp";
+    FILE *file = std::fopen(temporaryPath.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+    written = std::fclose(file) == 0 && written;
+    if (!written || std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+} // namespace react
+} // namespace facebook
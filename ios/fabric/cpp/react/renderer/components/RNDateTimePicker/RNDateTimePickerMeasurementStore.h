@@ -0,0 +1,49 @@
+/**
+ * On-disk format for the picker measurement cache, so sizes measured in one launch are known before
+ * the first picker mounts in the next. The file is a small versioned binary blob: any corruption,
+ * format change or OS update (UIKit metrics change between releases) makes it load as empty.
+ */
+
+#pragma once
+
+#include "RNDateTimePickerMeasurementCache.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+class RNDateTimePickerMeasurementStore final {
+  public:
+    using Entries = std::vector<std::pair<RNDateTimePickerMeasurementKey, Size>>;
+
+    static constexpr uint32_t kMagic = 0x54444E52; // "RNDT"
+    static constexpr uint32_t kFormatVersion = 1;
+
+    /*
+     * Serializes entries for the given OS version.
+     */
+    static std::vector<uint8_t> encode(const Entries &entries, const std::string &osVersion);
+
+    /*
+     * Parses a blob written by encode(). Returns no entries if the blob is truncated, fails its
+     * checksum, or was written by another format or OS version.
+     */
+    static Entries decode(const uint8_t *data, size_t length, const std::string &osVersion);
+
+    /*
+     * Memory-maps the file at path and decodes it. A missing file loads as empty.
+     */
+    static Entries load(const std::string &path, const std::string &osVersion);
+
+    /*
+     * Writes the blob to a temporary file and renames it over path, so readers never see a partial file.
+     */
+    static bool save(const std::string &path, const std::vector<uint8_t> &data);
+};
+
+} // namespace react
+} // namespace facebook
@@ -8,5 +8,17 @@
 namespace facebook {
 namespace react {
 
+namespace {
+std::atomic<size_t> stateCommitCount{0};
+} // namespace
+
+size_t RNDateTimePickerState::commitCount() {
+    return stateCommitCount.load(std::memory_order_relaxed);
+}
+
+void RNDateTimePickerState::recordCommit() {
+    stateCommitCount.fetch_add(1, std::memory_order_relaxed);
+}
+
 } // namespace react
-} // namespace facebook
\ No newline at end of file
+} // namespace facebook
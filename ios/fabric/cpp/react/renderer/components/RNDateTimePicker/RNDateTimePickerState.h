@@ -7,6 +7,11 @@
 
 #include <react/renderer/graphics/Geometry.h>
 
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+
 namespace facebook {
 namespace react {
 
@@ -15,9 +20,40 @@ class RNDateTimePickerState final {
     using Shared = std::shared_ptr<const RNDateTimePickerState>;
     RNDateTimePickerState(){};
     RNDateTimePickerState(Size frameSize_) : frameSize(frameSize_){};
-    
+
+    /*
+     * Sizes closer than this (in points) are treated as equal; UIKit measurements jitter by sub-pixel amounts.
+     */
+    static constexpr Float kFrameSizeTolerance = 0.5;
+
+    bool hasFrameSize(Size size, Float tolerance = kFrameSizeTolerance) const {
+        return std::abs(frameSize.width - size.width) <= tolerance &&
+            std::abs(frameSize.height - size.height) <= tolerance;
+    }
+
+    /*
+     * Number of state updates committed through updateFrameSize since launch.
+     */
+    static size_t commitCount();
+    static void recordCommit();
+
     Size frameSize{};
 };
 
+/*
+ * Updates the state with a new frame size unless it already holds an equal one, so that unchanged
+ * measurements do not schedule a shadow tree revision.
+ * Returns true when an update was committed.
+ */
+template <typename ConcreteStateT>
+bool updateFrameSize(const ConcreteStateT &state, Size frameSize) {
+    if (state.getData().hasFrameSize(frameSize)) {
+        return false;
+    }
+    RNDateTimePickerState::recordCommit();
+    state.updateState(RNDateTimePickerState{frameSize});
+    return true;
+}
+
 } // namespace react
 } // namespace facebook
@@ -1,17 +1,58 @@
 
 /**
  * This code was generated by [react-native-codegen](https://www.npmjs.com/package/react-native-codegen) 
- * and copied to the cpp directory to add custom state and set shadow node trait as a LeafYogaNode.
+ * and copied to the cpp directory to add custom state, set shadow node trait as a LeafYogaNode and measure
+ * the picker before the native view reports its size.
  *
  * @generated by codegen project: GenerateShadowNodeCpp.js
  */
 
 #include "ShadowNodes.h"
+#include "RNDateTimePickerMeasurementCache.h"
 
 namespace facebook {
 namespace react {
 
 extern const char RNDateTimePickerComponentName[] = "RNDateTimePicker";
 
+// Typical UIKit sizes at the default font scale, including the width the measurement service adds.
+// Only used until a picker with the same configuration has been measured.
+static Size defaultIntrinsicSize(const RNDateTimePickerProps &props) {
+    if (props.mode == RNDateTimePickerMode::Countdown || props.displayIOS == RNDateTimePickerDisplayIOS::Spinner) {
+        return Size{330, 216};
+    }
+    if (props.displayIOS == RNDateTimePickerDisplayIOS::Inline) {
+        switch (props.mode) {
+            case RNDateTimePickerMode::Date:
+                return Size{330, 330};
+            case RNDateTimePickerMode::Datetime:
+                return Size{330, 380};
+            default:
+                break;
+        }
+    }
+    // Compact, which is also the default style, and inline time pickers show the value as a button
+    switch (props.mode) {
+        case RNDateTimePickerMode::Time:
+            return Size{100, 34};
+        case RNDateTimePickerMode::Datetime:
+            return Size{210, 34};
+        default:
+            return Size{130, 34};
+    }
+}
+
+Size RNDateTimePickerShadowNode::measureContent(const LayoutContext &layoutContext, const LayoutConstraints &layoutConstraints) const {
+    const auto &frameSize = getStateData().frameSize;
+    if (frameSize.width != 0 && frameSize.height != 0) {
+        return layoutConstraints.clamp(frameSize);
+    }
+
+    const auto &props = getConcreteProps();
+    auto intrinsicSize = RNDateTimePickerMeasurementCache::shared().intrinsicSize(
+        static_cast<int>(props.mode), static_cast<int>(props.displayIOS), props.locale);
+    return layoutConstraints.clamp(intrinsicSize.value_or(defaultIntrinsicSize(props)));
+}
+
 } // namespace react
 } // namespace facebook
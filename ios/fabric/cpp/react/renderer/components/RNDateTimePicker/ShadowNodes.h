@@ -1,7 +1,8 @@
 
 /**
  * This code was generated by [react-native-codegen](https://www.npmjs.com/package/react-native-codegen)
- * and copied to the cpp directory to add custom state and set shadow node trait as a LeafYogaNode.
+ * and copied to the cpp directory to add custom state, set shadow node trait as a LeafYogaNode and measure
+ * the picker before the native view reports its size.
  *
  * @generated by codegen project: GenerateShadowNodeH.js
  */
@@ -31,8 +32,17 @@ public:
     static ShadowNodeTraits BaseTraits() {
         auto traits = ConcreteViewShadowNode::BaseTraits();
         traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
+        traits.set(ShadowNodeTraits::Trait::MeasurableYogaNode);
         return traits;
     }
+
+    /*
+     * Used for the first layout, before the native view has stored its measured size in the state
+     * (once it has, adopt() fixes the size). Falls back to the intrinsic size table filled by
+     * previously measured pickers with the same mode, display, locale, font scale and clock
+     * format, and to typical sizes for the mode and display before any has been measured.
+     */
+    Size measureContent(const LayoutContext &layoutContext, const LayoutConstraints &layoutConstraints) const override;
 };
 
 } // namespace react
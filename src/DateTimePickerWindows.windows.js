@@ -13,11 +13,17 @@ import invariant from 'invariant';
 import type {WindowsNativeProps} from './types';
 import NativeModuleDatePickerWindows from './specs/NativeModuleDatePickerWindows';
 import NativeModuleTimePickerWindows from './specs/NativeModuleTimePickerWindows';
+import NativeModulePickerDateMathWindows from './specs/NativeModulePickerDateMathWindows';
 import {
   createDateTimeSetEvtParams,
   createDismissEvtParams,
 } from './eventCreators';
 
+// Ids generated for open() requests without a sessionId. They count down from
+// -1 so they never collide with ids chosen by callers, and are shared by both
+// modules so dismiss(sessionId) can try each.
+let lastGeneratedSessionId = 0;
+
 function open(props: WindowsNativeProps) {
   const {
     mode = WINDOWS_MODE.date,
@@ -34,6 +40,9 @@ function open(props: WindowsNativeProps) {
     dayOfWeekFormat,
     dateFormat,
     placeholderText,
+    includeFields,
+    timeoutMs,
+    sessionId = --lastGeneratedSessionId,
   } = props;
 
   invariant(originalValue, 'A date or time must be specified as `value` prop.');
@@ -60,6 +69,9 @@ function open(props: WindowsNativeProps) {
           firstDayOfWeek,
           placeholderText,
           testID,
+          includeFields,
+          timeoutMs,
+          sessionId,
         });
       } else if (mode === WINDOWS_MODE.time) {
         // Use TimePicker TurboModule
@@ -73,6 +85,9 @@ function open(props: WindowsNativeProps) {
           is24Hour,
           minuteInterval,
           testID,
+          includeFields,
+          timeoutMs,
+          sessionId,
         });
       } else {
         throw new Error(`Unsupported mode: ${mode}`);
@@ -81,11 +96,27 @@ function open(props: WindowsNativeProps) {
       const {action} = result;
 
       if (action === DATE_SET_ACTION || action === TIME_SET_ACTION || action === 'dateSetAction' || action === 'timeSetAction') {
-        const event = createDateTimeSetEvtParams(
-          mode === WINDOWS_MODE.date ? result.timestamp : (result.hour * 3600 + result.minute * 60) * 1000,
-          result.utcOffset || 0
+        const [event, date] = createDateTimeSetEvtParams(
+          new Date(
+            mode === WINDOWS_MODE.date
+              ? result.timestamp
+              : (result.hour * 3600 + result.minute * 60) * 1000,
+          ),
+          result.utcOffset || 0,
         );
-        onChange && onChange(event, new Date(event.nativeEvent.timestamp));
+        if (includeFields) {
+          const {year, month, day, weekday, dayOfYear, isoWeek} = result;
+          event.nativeEvent = {
+            ...event.nativeEvent,
+            year,
+            month,
+            day,
+            weekday,
+            dayOfYear,
+            isoWeek,
+          };
+        }
+        onChange && onChange(event, date);
       } else if (action === DISMISS_ACTION || action === 'dismissedAction') {
         const event = createDismissEvtParams();
         onChange && onChange(event);
@@ -101,26 +132,351 @@ function open(props: WindowsNativeProps) {
   return presentPicker();
 }
 
-async function dismiss() {
-  // Try to dismiss both pickers since we don't know which one is open
+/**
+ * Dismisses the open() request with the given sessionId, or every pending
+ * request when it is omitted. Resolves false when no such request was pending.
+ */
+async function dismiss(sessionId?: ?number): Promise<boolean> {
+  // Ids are unique across both modules, so at most one of them has the request
+  let dismissed = false;
   try {
     if (NativeModuleDatePickerWindows) {
-      await NativeModuleDatePickerWindows.dismiss();
+      const result = await NativeModuleDatePickerWindows.dismiss(sessionId);
+      dismissed = dismissed || result;
     }
   } catch (e) {
     // Ignore if not open
   }
-  
+
   try {
     if (NativeModuleTimePickerWindows) {
-      await NativeModuleTimePickerWindows.dismiss();
+      const result = await NativeModuleTimePickerWindows.dismiss(sessionId);
+      dismissed = dismissed || result;
     }
   } catch (e) {
     // Ignore if not open
   }
+  return dismissed;
+}
+
+// Installed by the native PickerValuesModule (see windows/DateTimePickerWindows/PickerValuesModuleWindows.h)
+function getValuesHostObject() {
+  return global.__rnDateTimePickerValues;
+}
+
+// Installed next to it by the same module, with the native counters
+function getStatsHostObject() {
+  return global.__rnDateTimePickerStats;
+}
+
+/**
+ * Synchronously reads the value (milliseconds since epoch) last committed by
+ * the mounted picker with the given native tag, without waiting for onChange.
+ */
+function getValue(viewTag: number): ?number {
+  const hostObject = getValuesHostObject();
+  return hostObject ? hostObject.getValue(viewTag) : undefined;
+}
+
+function getValues(viewTags: $ReadOnlyArray<number>): Array<?number> {
+  const hostObject = getValuesHostObject();
+  return hostObject
+    ? hostObject.getValues(viewTags)
+    : viewTags.map(() => undefined);
+}
+
+/**
+ * Like getValues, for many pickers at once: reads into a Float64Array (out,
+ * when given and long enough, or a new one), with NaN for missing values.
+ */
+function getValuesArray(
+  viewTags: $ReadOnlyArray<number> | Float64Array,
+  out?: Float64Array,
+): Float64Array {
+  const hostObject = getValuesHostObject();
+  if (hostObject && hostObject.getValuesArray) {
+    return hostObject.getValuesArray(viewTags, out);
+  }
+  const result =
+    out && out.length >= viewTags.length ? out : new Float64Array(viewTags.length);
+  for (let i = 0; i < viewTags.length; i++) {
+    const value = getValue(viewTags[i]);
+    result[i] = value == null ? NaN : value;
+  }
+  return result;
+}
+
+/**
+ * Native change-event queue counters, aggregated over all pickers.
+ */
+function getEventQueueStats(): ?{
+  pending: number,
+  maxDepth: number,
+  dropped: number,
+  delivered: number,
+} {
+  const hostObject = getStatsHostObject();
+  return hostObject ? hostObject.getEventQueueStats() : undefined;
+}
+
+/**
+ * Native prop update counters: plans prepared off the UI thread, and the
+ * time the UI thread spent applying them. Fabric pickers that are offscreen
+ * (zero-size layout or hidden island) hold updates back: deferred counts
+ * those updates, collapsed the ones merged into a later update, and flushed
+ * the merged updates applied when a picker came back.
+ */
+function getApplyStats(): ?{
+  plans: number,
+  applies: number,
+  meanApplyMs: number,
+  maxApplyMs: number,
+  offscreenSuspended: number,
+  offscreenResumed: number,
+  deferred: number,
+  collapsed: number,
+  flushed: number,
+} {
+  const hostObject = getStatsHostObject();
+  return hostObject && hostObject.getApplyStats
+    ? hostObject.getApplyStats()
+    : undefined;
+}
+
+/**
+ * Outcomes of imperative open() requests, and the latency from open() to the
+ * picker dialog being on screen.
+ */
+function getSessionStats(): ?{
+  opened: number,
+  selected: number,
+  dismissed: number,
+  timedOut: number,
+  cancelled: number,
+  meanShownMs: number,
+  maxShownMs: number,
+  active: number,
+  maxActive: number,
+  componentsCreated: number,
+  componentsReused: number,
+} {
+  const hostObject = getStatsHostObject();
+  return hostObject && hostObject.getSessionStats
+    ? hostObject.getSessionStats()
+    : undefined;
+}
+
+/**
+ * Native XamlIsland pool counters for Fabric pickers, aggregated over all UI threads.
+ */
+function getPoolStats(): ?{
+  hits: number,
+  misses: number,
+  returned: number,
+  discarded: number,
+  warmed: number,
+} {
+  const hostObject = getStatsHostObject();
+  return hostObject && hostObject.getPoolStats
+    ? hostObject.getPoolStats()
+    : undefined;
+}
+
+/**
+ * State and timing of the optional native idle warm-up of the first picker
+ * (see ReactPackageProvider.WarmUpPickers).
+ */
+function getWarmUpStats(): ?{
+  state: 'notRequested' | 'pending' | 'completed' | 'cancelled' | 'skipped',
+  busyMs: number,
+  elapsedMs: number,
+} {
+  const hostObject = getStatsHostObject();
+  return hostObject && hostObject.getWarmUpStats
+    ? hostObject.getWarmUpStats()
+    : undefined;
+}
+
+/**
+ * Refreshes of mounted Fabric pickers after a time zone or regional settings
+ * change (see ReactPackageProvider.NotifyTimeZoneOrLocaleChanged), for this
+ * window.
+ */
+function getLocaleStats(): ?{
+  liveViews: number,
+  batches: number,
+  viewsUpdated: number,
+  lastBatchViews: number,
+  lastBatchMs: number,
+  maxBatchMs: number,
+} {
+  const hostObject = getStatsHostObject();
+  return hostObject && hostObject.getLocaleStats
+    ? hostObject.getLocaleStats()
+    : undefined;
+}
+
+function getDateMathModule() {
+  invariant(
+    NativeModulePickerDateMathWindows,
+    'NativeModulePickerDateMathWindows is not available',
+  );
+  return NativeModulePickerDateMathWindows;
+}
+
+type TimestampArray = Float64Array | BigInt64Array;
+
+function isTimestampArray(value: mixed): boolean {
+  return (
+    value instanceof Float64Array ||
+    (typeof BigInt64Array !== 'undefined' && value instanceof BigInt64Array)
+  );
+}
+
+// The typed-array variant of a date math function on the JSI host object,
+// which works on the array's buffer in place (see PickerDateMathJsi.h)
+function getTypedDateMath(name: string): ?Function {
+  const hostObject = getValuesHostObject();
+  return hostObject ? hostObject[name] : undefined;
+}
+
+// Plain numbers for the TurboModule, which takes arrays
+function toNumbers(
+  values: $ReadOnlyArray<number> | TimestampArray,
+): $ReadOnlyArray<number> {
+  return Array.isArray(values) ? values : Array.from(values, Number);
+}
+
+/**
+ * Batch date arithmetic, run natively in one synchronous call. Dates are
+ * timestamps (milliseconds since epoch) computed in the local time zone, or
+ * at timeZoneOffsetInSeconds from UTC, and keep their time of day. Invalid
+ * timestamps come back as NaN.
+ *
+ * Passing dates as a Float64Array (or a BigInt64Array, where invalid
+ * timestamps are -2^63) skips the per-element conversion: the array is
+ * updated in place and returned.
+ *
+ * addCalendarUnits adds years and months first, clamping the day to the end
+ * of the target month (Jan 31 + 1 month = Feb 28 or 29), then days.
+ */
+function addCalendarUnits(
+  dates: $ReadOnlyArray<number> | TimestampArray,
+  {years = 0, months = 0, days = 0}: {years?: number, months?: number, days?: number},
+  timeZoneOffsetInSeconds?: number,
+): Array<number> | TimestampArray {
+  const typed = getTypedDateMath('addCalendarUnits');
+  if (typed && isTimestampArray(dates)) {
+    return typed(dates, years, months, days, timeZoneOffsetInSeconds);
+  }
+  return getDateMathModule().addCalendarUnits(
+    toNumbers(dates),
+    years,
+    months,
+    days,
+    timeZoneOffsetInSeconds,
+  );
+}
+
+/**
+ * Moves each date by count business days (Monday to Friday, minus the local
+ * days of the given holidays). Negative counts move backwards.
+ */
+function addBusinessDays(
+  dates: $ReadOnlyArray<number> | TimestampArray,
+  count: number,
+  holidays: $ReadOnlyArray<number> | TimestampArray = [],
+  timeZoneOffsetInSeconds?: number,
+): Array<number> | TimestampArray {
+  const typed = getTypedDateMath('addBusinessDays');
+  if (typed && isTimestampArray(dates)) {
+    return typed(dates, count, holidays, timeZoneOffsetInSeconds);
+  }
+  return getDateMathModule().addBusinessDays(
+    toNumbers(dates),
+    count,
+    toNumbers(holidays),
+    timeZoneOffsetInSeconds,
+  );
+}
+
+/**
+ * The count business days following start, at its time of day. Holidays
+ * given as a typed array are read in place, and the days come back as a
+ * Float64Array.
+ */
+function nextBusinessDays(
+  start: number,
+  count: number,
+  holidays: $ReadOnlyArray<number> | TimestampArray = [],
+  timeZoneOffsetInSeconds?: number,
+): Array<number> | Float64Array {
+  const typed = getTypedDateMath('nextBusinessDays');
+  if (typed && isTimestampArray(holidays)) {
+    return typed(start, count, holidays, timeZoneOffsetInSeconds);
+  }
+  return getDateMathModule().nextBusinessDays(
+    start,
+    count,
+    toNumbers(holidays),
+    timeZoneOffsetInSeconds,
+  );
+}
+
+/**
+ * Clamps each date into [minimumDate, maximumDate]; a missing bound is open.
+ */
+function clampDates(
+  dates: $ReadOnlyArray<number> | TimestampArray,
+  minimumDate?: ?number,
+  maximumDate?: ?number,
+): Array<number> | TimestampArray {
+  const typed = getTypedDateMath('clampDates');
+  if (typed && isTimestampArray(dates)) {
+    return typed(dates, minimumDate, maximumDate);
+  }
+  return getDateMathModule().clampDates(
+    toNumbers(dates),
+    minimumDate,
+    maximumDate,
+  );
+}
+
+/**
+ * Intersects two sets of inclusive ranges given as flat
+ * [start, end, start, end, ...] arrays, in any order. Returns sorted,
+ * disjoint ranges in the same form, as a Float64Array when both inputs are
+ * typed arrays.
+ */
+function intersectDateRanges(
+  first: $ReadOnlyArray<number> | TimestampArray,
+  second: $ReadOnlyArray<number> | TimestampArray,
+): Array<number> | Float64Array {
+  const typed = getTypedDateMath('intersectDateRanges');
+  if (typed && isTimestampArray(first) && isTimestampArray(second)) {
+    return typed(first, second);
+  }
+  return getDateMathModule().intersectDateRanges(
+    toNumbers(first),
+    toNumbers(second),
+  );
 }
 
 export const DateTimePickerWindows = {
   open,
   dismiss,
+  getValue,
+  getValues,
+  getValuesArray,
+  getEventQueueStats,
+  getApplyStats,
+  getPoolStats,
+  getSessionStats,
+  getWarmUpStats,
+  getLocaleStats,
+  addCalendarUnits,
+  addBusinessDays,
+  nextBusinessDays,
+  clampDates,
+  intersectDateRanges,
 };
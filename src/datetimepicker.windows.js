@@ -7,6 +7,8 @@
 'use strict';
 
 import {
+  DeviceEventEmitter,
+  findNodeHandle,
   requireNativeComponent,
   StyleSheet,
 } from 'react-native';
@@ -34,6 +36,41 @@ export const RNDateTimePickerWindows = requireNativeComponent(
 // $FlowFixMe[underconstrained-implicit-instantiation]
 const RNTimePickerWindows = requireNativeComponent('RNTimePickerWindows');
 
+// When ReactPackageProvider::BatchChangeEvents is enabled natively, change events of all
+// pickers arrive as one device event per frame; each entry carries its view tag in `target`.
+const BATCHED_CHANGE_EVENT = 'dateTimePickerBatchedChange';
+const batchedChangeHandlers: Map<
+  number,
+  (event: WindowsDatePickerChangeEvent) => void,
+> = new Map();
+let batchedChangeSubscription = null;
+
+function subscribeToBatchedChanges(
+  viewTag: number,
+  handler: (event: WindowsDatePickerChangeEvent) => void,
+): () => void {
+  batchedChangeHandlers.set(viewTag, handler);
+  if (batchedChangeSubscription == null) {
+    batchedChangeSubscription = DeviceEventEmitter.addListener(
+      BATCHED_CHANGE_EVENT,
+      (entries) => {
+        entries.forEach(({target, ...nativeEvent}) => {
+          const entryHandler = batchedChangeHandlers.get(target);
+          entryHandler && entryHandler({nativeEvent});
+        });
+      },
+    );
+  }
+
+  return () => {
+    batchedChangeHandlers.delete(viewTag);
+    if (batchedChangeHandlers.size === 0 && batchedChangeSubscription != null) {
+      batchedChangeSubscription.remove();
+      batchedChangeSubscription = null;
+    }
+  };
+}
+
 export default function RNDateTimePickerQWE(
   props: WindowsNativeProps,
 ): React.Node {
@@ -44,6 +81,8 @@ export default function RNDateTimePickerQWE(
     dayOfWeekFormat: props.dayOfWeekFormat,
     dateFormat: props.dateFormat,
     firstDayOfWeek: props.firstDayOfWeek,
+    includeFields: props.includeFields,
+    lazy: props.lazy,
     maxDate: props.maximumDate ? props.maximumDate.getTime() : undefined, // time in milliseconds
     minDate: props.minimumDate ? props.minimumDate.getTime() : undefined, // time in milliseconds
     onChange: props.onChange,
@@ -67,6 +106,19 @@ export default function RNDateTimePickerQWE(
     onChange && onChange(unifiedEvent, new Date(event.nativeEvent.newDate));
   };
 
+  const nativeRef = React.useRef(null);
+  const onChangeRef = React.useRef(_onChange);
+  onChangeRef.current = _onChange;
+  React.useEffect(() => {
+    const viewTag = findNodeHandle(nativeRef.current);
+    if (typeof viewTag !== 'number') {
+      return undefined;
+    }
+    return subscribeToBatchedChanges(viewTag, (event) =>
+      onChangeRef.current(event),
+    );
+  }, []);
+
   // $FlowFixMe[recursive-definition]
   const timezoneOffsetInSeconds = (() => {
     // The Date object returns timezone in minutes. Convert that to seconds
@@ -83,6 +135,7 @@ export default function RNDateTimePickerQWE(
   if (mode === WINDOWS_MODE.date || mode == null) {
     return (
       <RNDateTimePickerWindows
+        ref={nativeRef}
         {...localProps}
         onChange={_onChange}
         timeZoneOffsetInSeconds={timezoneOffsetInSeconds}
@@ -91,10 +144,13 @@ export default function RNDateTimePickerQWE(
   } else if (mode === WINDOWS_MODE.time) {
     return (
       <RNTimePickerWindows
+        ref={nativeRef}
         style={props.style}
         is24Hour={props.is24Hour}
         selectedTime={localProps.selectedDate}
         minuteInterval={props.minuteInterval}
+        includeFields={props.includeFields}
+        lazy={props.lazy}
         onChange={_onChange}
       />
     );
@@ -247,6 +247,26 @@ export type WindowsNativeProps = Readonly<
       is24Hour?: boolean;
       minuteInterval?: number;
       accessibilityLabel?: string;
+      /**
+       * When true, change events also carry year, month, day, weekday,
+       * dayOfYear and isoWeek computed natively.
+       */
+      includeFields?: boolean;
+      /**
+       * When true, the picker shows its formatted value as plain text and
+       * only creates the native control on focus, pointer-over or tap.
+       */
+      lazy?: boolean;
+      /**
+       * DateTimePickerWindows.open only: settles the request as dismissed
+       * when nothing is picked within this many milliseconds.
+       */
+      timeoutMs?: number;
+      /**
+       * DateTimePickerWindows.open only: id of the request, for
+       * dismiss(sessionId). Generated when omitted, and echoed in the result.
+       */
+      sessionId?: number;
     }
 >;
 
@@ -0,0 +1,42 @@
+// @flow strict-local
+import type {ViewProps} from 'react-native/Libraries/Components/View/ViewPropTypes';
+import type {HostComponent} from 'react-native';
+
+import type {
+  BubblingEventHandler,
+  Double,
+  Int32,
+} from 'react-native/Libraries/Types/CodegenTypes';
+import codegenNativeComponent from 'react-native/Libraries/Utilities/codegenNativeComponent';
+
+type DateTimePickerWindowsChangeEvent = $ReadOnly<{|
+  newDate: Double,
+  year?: Int32,
+  month?: Int32,
+  day?: Int32,
+  weekday?: Int32,
+  dayOfYear?: Int32,
+  isoWeek?: Int32,
+  valuesSkipped?: boolean,
+|}>;
+
+type NativeProps = $ReadOnly<{|
+  ...ViewProps,
+  selectedDate?: ?Double,
+  maximumDate?: ?Double,
+  minimumDate?: ?Double,
+  timeZoneOffsetInSeconds?: ?Double,
+  dayOfWeekFormat?: ?string,
+  dateFormat?: ?string,
+  firstDayOfWeek?: ?Int32,
+  placeholderText?: ?string,
+  accessibilityLabel?: ?string,
+  includeFields?: ?boolean,
+  lazy?: ?boolean,
+  onChange?: ?BubblingEventHandler<DateTimePickerWindowsChangeEvent>,
+|}>;
+
+export default (codegenNativeComponent<NativeProps>('RNDateTimePickerWindows', {
+  excludedPlatforms: ['iOS', 'android'],
+  interfaceOnly: true,
+}): HostComponent<NativeProps>);
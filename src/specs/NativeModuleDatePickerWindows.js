@@ -12,6 +12,9 @@ export type DatePickerOpenParams = $ReadOnly<{
   placeholderText?: string,
   testID?: string,
   timeZoneOffsetInSeconds?: number,
+  includeFields?: boolean,
+  timeoutMs?: number,
+  sessionId?: number,
 }>;
 
 type DateSetAction = 'dateSetAction' | 'dismissedAction';
@@ -19,10 +22,17 @@ type DatePickerResult = $ReadOnly<{
   action: DateSetAction,
   timestamp: number,
   utcOffset: number,
+  year?: number,
+  month?: number,
+  day?: number,
+  weekday?: number,
+  dayOfYear?: number,
+  isoWeek?: number,
+  sessionId: number,
 }>;
 
 export interface Spec extends TurboModule {
-  +dismiss: () => Promise<boolean>;
+  +dismiss: (sessionId?: ?number) => Promise<boolean>;
   +open: (params: DatePickerOpenParams) => Promise<DatePickerResult>;
 }
 
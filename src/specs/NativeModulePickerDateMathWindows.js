@@ -0,0 +1,37 @@
+// @flow strict-local
+
+import type {TurboModule} from 'react-native/Libraries/TurboModule/RCTExport';
+import {TurboModuleRegistry} from 'react-native';
+
+export interface Spec extends TurboModule {
+  +addCalendarUnits: (
+    dates: $ReadOnlyArray<number>,
+    years: number,
+    months: number,
+    days: number,
+    timeZoneOffsetInSeconds?: ?number,
+  ) => Array<number>;
+  +addBusinessDays: (
+    dates: $ReadOnlyArray<number>,
+    count: number,
+    holidays: $ReadOnlyArray<number>,
+    timeZoneOffsetInSeconds?: ?number,
+  ) => Array<number>;
+  +nextBusinessDays: (
+    start: number,
+    count: number,
+    holidays: $ReadOnlyArray<number>,
+    timeZoneOffsetInSeconds?: ?number,
+  ) => Array<number>;
+  +clampDates: (
+    dates: $ReadOnlyArray<number>,
+    minimumDate?: ?number,
+    maximumDate?: ?number,
+  ) => Array<number>;
+  +intersectDateRanges: (
+    first: $ReadOnlyArray<number>,
+    second: $ReadOnlyArray<number>,
+  ) => Array<number>;
+}
+
+export default (TurboModuleRegistry.get<Spec>('RNCPickerDateMathWindows'): ?Spec);
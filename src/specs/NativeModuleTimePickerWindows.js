@@ -8,6 +8,9 @@ export type TimePickerOpenParams = $ReadOnly<{
   minuteInterval?: number,
   selectedTime?: number,
   testID?: string,
+  includeFields?: boolean,
+  timeoutMs?: number,
+  sessionId?: number,
 }>;
 
 type TimeSetAction = 'timeSetAction' | 'dismissedAction';
@@ -15,10 +18,17 @@ type TimePickerResult = $ReadOnly<{
   action: TimeSetAction,
   hour: number,
   minute: number,
+  year?: number,
+  month?: number,
+  day?: number,
+  weekday?: number,
+  dayOfYear?: number,
+  isoWeek?: number,
+  sessionId: number,
 }>;
 
 export interface Spec extends TurboModule {
-  +dismiss: () => Promise<boolean>;
+  +dismiss: (sessionId?: ?number) => Promise<boolean>;
   +open: (params: TimePickerOpenParams) => Promise<TimePickerResult>;
 }
 
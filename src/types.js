@@ -278,9 +278,20 @@ export type NativeRef = {
   current: ElementRef<RCTDateTimePickerNative> | null,
 };
 
+export type WindowsCalendarFields = {|
+  year?: number,
+  month?: number,
+  day?: number,
+  weekday?: number,
+  dayOfYear?: number,
+  isoWeek?: number,
+|};
+
 export type WindowsDatePickerChangeEvent = {|
   nativeEvent: {|
     newDate: number,
+    valuesSkipped?: boolean,
+    ...WindowsCalendarFields,
   |},
 |};
 
@@ -303,4 +314,31 @@ export type WindowsNativeProps = $ReadOnly<{|
   is24Hour?: boolean,
   minuteInterval?: number,
   accessibilityLabel?: string,
+
+  /**
+   * When true, change events also carry year, month, day, weekday, dayOfYear
+   * and isoWeek computed natively, so no Date needs to be constructed in JS.
+   */
+  includeFields?: boolean,
+
+  /**
+   * When true, the picker shows its formatted value as plain text and only
+   * creates the native control on focus, pointer-over or tap. Useful for
+   * long lists where most pickers are never touched.
+   */
+  lazy?: boolean,
+
+  /**
+   * DateTimePickerWindows.open only: settles the request as dismissed when
+   * nothing is picked within this many milliseconds.
+   */
+  timeoutMs?: number,
+
+  /**
+   * DateTimePickerWindows.open only: id of the request, for dismiss(sessionId).
+   * Requests with different ids stay open side by side; one with an id that is
+   * still open replaces it. Use non-negative ids; generated ids are negative.
+   * Generated when omitted, and echoed in the result.
+   */
+  sessionId?: number,
 |}>;
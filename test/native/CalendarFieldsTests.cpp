@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CivilDate.h"
+#include "TestClocks.h"
+
+#include <gtest/gtest.h>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+TEST(CalendarFields, IsoWeeksAtYearBoundaries) {
+  struct Case {
+    int64_t year;
+    int32_t month;
+    int32_t day;
+    int32_t isoWeek;
+    int32_t weekday;
+  };
+  const Case cases[] = {
+      {2021, 1, 1, 53, 5},   // Friday, still in week 53 of 2020
+      {2021, 1, 4, 1, 1},    // first Monday of 2021
+      {2024, 1, 1, 1, 1},    // Monday
+      {2024, 12, 29, 52, 0}, // Sunday
+      {2024, 12, 30, 1, 1},  // Monday, week 1 of 2025
+      {2026, 12, 31, 53, 4}, // Thursday of a 53-week year
+      {2027, 1, 3, 53, 0},   // Sunday, still week 53 of 2026
+      {1970, 1, 1, 1, 4},
+      {1969, 12, 28, 52, 0},
+  };
+  for (const auto &item : cases) {
+    const auto fields = CalendarFieldsFromLocalMilliseconds(UtcMilliseconds(item.year, item.month, item.day, 12));
+    EXPECT_EQ(fields.isoWeek, item.isoWeek) << item.year << "-" << item.month << "-" << item.day;
+    EXPECT_EQ(fields.weekday, item.weekday) << item.year << "-" << item.month << "-" << item.day;
+    EXPECT_EQ(fields.year, item.year);
+    EXPECT_EQ(fields.month, item.month);
+    EXPECT_EQ(fields.day, item.day);
+  }
+}
+
+TEST(CalendarFields, DayOfYearCountsLeapDays) {
+  EXPECT_EQ(CalendarFieldsFromLocalMilliseconds(UtcMilliseconds(2024, 12, 31)).dayOfYear, 366);
+  EXPECT_EQ(CalendarFieldsFromLocalMilliseconds(UtcMilliseconds(2023, 12, 31)).dayOfYear, 365);
+  EXPECT_EQ(CalendarFieldsFromLocalMilliseconds(UtcMilliseconds(2024, 3, 1)).dayOfYear, 61);
+  // Negative local milliseconds fall on the previous day
+  EXPECT_EQ(CalendarFieldsFromLocalMilliseconds(-1).day, 31);
+}
+
+} // namespace
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "CivilDate.h"
+#include "DateMath.h"
+#include "TestClocks.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+// Timestamps spread over a year, with random times of day
+template <typename T>
+std::vector<T> YearOfTimestamps(size_t count) {
+  std::mt19937_64 random{42};
+  std::uniform_int_distribution<int64_t> offset{0, 365 * kMillisecondsPerDay};
+  std::vector<T> values(count);
+  for (auto &value : values) {
+    value = static_cast<T>(UtcMilliseconds(2024, 1, 1) + offset(random));
+  }
+  return values;
+}
+
+// Ranges of up to a week each, starting over a year, as unsorted flat [start, end] pairs
+template <typename T>
+std::vector<T> YearOfRanges(size_t count, uint64_t seed) {
+  std::mt19937_64 random{seed};
+  std::uniform_int_distribution<int64_t> offset{0, 365 * kMillisecondsPerDay};
+  std::uniform_int_distribution<int64_t> length{0, 7 * kMillisecondsPerDay};
+  std::vector<T> values;
+  values.reserve(count * 2);
+  for (size_t i = 0; i < count; ++i) {
+    const int64_t start = UtcMilliseconds(2024, 1, 1) + offset(random);
+    values.push_back(static_cast<T>(start));
+    values.push_back(static_cast<T>(start + length(random)));
+  }
+  return values;
+}
+
+// Arrays of a million elements, as a large batch sent from JS would be
+constexpr int64_t kLargeBatch = 1 << 20;
+
+template <typename T>
+void BM_AddCalendarOffset(benchmark::State &state) {
+  const auto input = YearOfTimestamps<T>(static_cast<size_t>(state.range(0)));
+  const EasternClock clock{0};
+  std::vector<T> values;
+  for (auto _ : state) {
+    values = input;
+    ZoneOffsets zone = state.range(1) ? ZoneOffsets{clock} : ZoneOffsets{int64_t{-5 * 3600}};
+    AddCalendarOffset(std::span<T>{values}, {0, 1, 2}, zone);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddCalendarOffset<double>)->ArgsProduct({{1000, 100000, kLargeBatch}, {0, 1}});
+BENCHMARK(BM_AddCalendarOffset<int64_t>)->ArgsProduct({{1000, 100000, kLargeBatch}, {0, 1}});
+
+template <typename T>
+void BM_AddBusinessDays(benchmark::State &state) {
+  const auto input = YearOfTimestamps<T>(static_cast<size_t>(state.range(0)));
+  const auto holidays = YearOfTimestamps<double>(20);
+  ZoneOffsets zone{int64_t{-5 * 3600}};
+  const BusinessCalendar calendar{std::span<const double>{holidays}, zone};
+  std::vector<T> values;
+  for (auto _ : state) {
+    values = input;
+    AddBusinessDays(std::span<T>{values}, 10, calendar, zone);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AddBusinessDays<double>)->Arg(1000)->Arg(100000)->Arg(kLargeBatch);
+BENCHMARK(BM_AddBusinessDays<int64_t>)->Arg(1000)->Arg(100000)->Arg(kLargeBatch);
+
+template <typename T>
+void BM_ClampTimestamps(benchmark::State &state) {
+  const auto input = YearOfTimestamps<T>(static_cast<size_t>(state.range(0)));
+  const double low = static_cast<double>(UtcMilliseconds(2024, 4, 1));
+  const double high = static_cast<double>(UtcMilliseconds(2024, 9, 1));
+  std::vector<T> values;
+  for (auto _ : state) {
+    values = input;
+    ClampTimestamps(std::span<T>{values}, low, high);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ClampTimestamps<double>)->Arg(100000)->Arg(kLargeBatch);
+BENCHMARK(BM_ClampTimestamps<int64_t>)->Arg(100000)->Arg(kLargeBatch);
+
+// The argument is the number of ranges on each side
+void BM_IntersectRanges(benchmark::State &state) {
+  const auto first = YearOfRanges<double>(static_cast<size_t>(state.range(0)), 1);
+  const auto second = YearOfRanges<int64_t>(static_cast<size_t>(state.range(0)), 2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(IntersectRanges(std::span<const double>{first}, std::span<const int64_t>{second}));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_IntersectRanges)->Arg(10000)->Arg(500000)->Unit(benchmark::kMillisecond);
+
+// The fields added to each change event when includeFields is set
+void BM_CalendarFieldsFromLocalMilliseconds(benchmark::State &state) {
+  const auto values = YearOfTimestamps<int64_t>(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    int64_t checksum = 0;
+    for (const int64_t value : values) {
+      const auto fields = CalendarFieldsFromLocalMilliseconds(value);
+      checksum += fields.isoWeek + fields.dayOfYear;
+    }
+    benchmark::DoNotOptimize(checksum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CalendarFieldsFromLocalMilliseconds)->Arg(1000)->Arg(100000);
+
+} // namespace
@@ -0,0 +1,192 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "DateMath.h"
+#include "TestClocks.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+double AddCalendarOffset(double value, CalendarOffset offset, ZoneOffsets &zone) {
+  std::vector<double> values{value};
+  winrt::DateTimePicker::Helpers::AddCalendarOffset(std::span<double>{values}, offset, zone);
+  return values[0];
+}
+
+TEST(ZoneOffsets, SkippedWallTimeMapsPastTheTransition) {
+  const EasternClock clock{0};
+  ZoneOffsets zone{clock};
+
+  // 2024-03-09 02:30 EST + 1 day is 02:30 on the 10th, which does not exist: 03:30 EDT
+  const double start = static_cast<double>(EasternMilliseconds(2024, 3, 9, 2, 30));
+  EXPECT_EQ(AddCalendarOffset(start, {0, 0, 1}, zone), static_cast<double>(UtcMilliseconds(2024, 3, 10, 7, 30)));
+  EXPECT_EQ(AddCalendarOffset(start, {0, 0, 1}, zone), static_cast<double>(EasternMilliseconds(2024, 3, 10, 3, 30)));
+}
+
+TEST(ZoneOffsets, SkippedWallTimeMapsPastTheTransitionWithAWarmCache) {
+  const EasternClock clock{0};
+  ZoneOffsets zone{clock};
+
+  // Converting a time earlier on the same day first leaves the pre-transition offset cached
+  EXPECT_EQ(zone.ToUtcMilliseconds(UtcMilliseconds(2024, 3, 10, 1, 0)), UtcMilliseconds(2024, 3, 10, 6, 0));
+  EXPECT_EQ(zone.ToUtcMilliseconds(UtcMilliseconds(2024, 3, 10, 2, 30)), UtcMilliseconds(2024, 3, 10, 7, 30));
+  EXPECT_EQ(zone.ToUtcMilliseconds(UtcMilliseconds(2024, 3, 10, 3, 0)), UtcMilliseconds(2024, 3, 10, 7, 0));
+}
+
+TEST(ZoneOffsets, RepeatedWallTimeMapsToItsFirstOccurrence) {
+  const EasternClock clock{0};
+  ZoneOffsets zone{clock};
+
+  // 01:30 on 2024-11-03 happens at 05:30 UTC (EDT) and again at 06:30 UTC (EST)
+  const double start = static_cast<double>(EasternMilliseconds(2024, 11, 2, 1, 30));
+  EXPECT_EQ(AddCalendarOffset(start, {0, 0, 1}, zone), static_cast<double>(UtcMilliseconds(2024, 11, 3, 5, 30)));
+
+  // Also when coming from after the transition
+  const double later = static_cast<double>(EasternMilliseconds(2024, 11, 4, 1, 30));
+  EXPECT_EQ(AddCalendarOffset(later, {0, 0, -1}, zone), static_cast<double>(UtcMilliseconds(2024, 11, 3, 5, 30)));
+}
+
+TEST(ZoneOffsets, KeepsTheWallTimeAcrossTransitions) {
+  const EasternClock clock{0};
+  ZoneOffsets zone{clock};
+
+  const double winter = static_cast<double>(EasternMilliseconds(2024, 1, 15, 9, 0));
+  EXPECT_EQ(AddCalendarOffset(winter, {0, 6, 0}, zone), static_cast<double>(EasternMilliseconds(2024, 7, 15, 9, 0)));
+  const double summer = static_cast<double>(EasternMilliseconds(2024, 7, 15, 23, 45));
+  EXPECT_EQ(AddCalendarOffset(summer, {0, 6, 0}, zone), static_cast<double>(EasternMilliseconds(2025, 1, 15, 23, 45)));
+}
+
+TEST(ZoneOffsets, RoundTripsEveryQuarterHourOfAYear) {
+  const EasternClock clock{0};
+  ZoneOffsets zone{clock};
+
+  for (int64_t utc = UtcMilliseconds(2024, 1, 1); utc < UtcMilliseconds(2025, 1, 1); utc += 15 * 60 * 1000) {
+    const int64_t local = zone.ToLocalMilliseconds(utc);
+    const int64_t back = zone.ToUtcMilliseconds(local);
+    // Only the second occurrence of a repeated hour maps elsewhere, one hour earlier
+    if (back != utc) {
+      ASSERT_EQ(back, utc - 3600 * 1000) << utc;
+      ASSERT_EQ(zone.ToLocalMilliseconds(back), local) << utc;
+    }
+  }
+}
+
+TEST(AddCalendarOffset, ClampsToTheEndOfTheMonth) {
+  ZoneOffsets zone{int64_t{0}};
+  const double january31 = static_cast<double>(UtcMilliseconds(2024, 1, 31, 10));
+  EXPECT_EQ(AddCalendarOffset(january31, {0, 1, 0}, zone), static_cast<double>(UtcMilliseconds(2024, 2, 29, 10)));
+  EXPECT_EQ(AddCalendarOffset(january31, {1, 1, 0}, zone), static_cast<double>(UtcMilliseconds(2025, 2, 28, 10)));
+  EXPECT_EQ(AddCalendarOffset(january31, {0, 1, 1}, zone), static_cast<double>(UtcMilliseconds(2024, 3, 1, 10)));
+}
+
+TEST(AddCalendarOffset, KeepsInvalidTimestampsInvalid) {
+  ZoneOffsets zone{int64_t{0}};
+  std::vector<double> values{std::nan(""), 9e15};
+  winrt::DateTimePicker::Helpers::AddCalendarOffset(std::span<double>{values}, {0, 0, 1}, zone);
+  EXPECT_TRUE(std::isnan(values[0]));
+  EXPECT_TRUE(std::isnan(values[1]));
+
+  std::vector<int64_t> wide{kInvalidTimestamp64};
+  winrt::DateTimePicker::Helpers::AddCalendarOffset(std::span<int64_t>{wide}, {0, 0, 1}, zone);
+  EXPECT_EQ(wide[0], kInvalidTimestamp64);
+}
+
+// Steps one day at a time, the way the closed form must agree with
+int64_t AddBusinessDaysByStepping(const BusinessCalendar &calendar, int64_t day, int64_t count) {
+  const int64_t step = count > 0 ? 1 : -1;
+  for (int64_t remaining = count; remaining != 0;) {
+    day += step;
+    if (calendar.IsBusinessDay(day)) {
+      remaining -= step;
+    }
+  }
+  return day;
+}
+
+TEST(BusinessCalendar, AddBusinessDaysMatchesSteppingOneDayAtATime) {
+  std::mt19937_64 random{20240607};
+  ZoneOffsets zone{int64_t{0}};
+  const int64_t firstDay = DaysFromCivil(2024, 1, 1);
+
+  for (int calendarIndex = 0; calendarIndex < 20; ++calendarIndex) {
+    std::vector<double> holidays;
+    const int holidayCount = std::uniform_int_distribution<int>{0, 120}(random);
+    for (int i = 0; i < holidayCount; ++i) {
+      const int64_t day = firstDay + std::uniform_int_distribution<int64_t>{-30, 400}(random);
+      holidays.push_back(static_cast<double>(day * kMillisecondsPerDay + 12 * 3600 * 1000));
+    }
+    const BusinessCalendar calendar{std::span<const double>{holidays}, zone};
+
+    for (int i = 0; i < 1000; ++i) {
+      const int64_t day = firstDay + std::uniform_int_distribution<int64_t>{0, 365}(random);
+      const int64_t count = std::uniform_int_distribution<int64_t>{-60, 60}(random);
+      const int64_t expected = count == 0 ? day : AddBusinessDaysByStepping(calendar, day, count);
+      ASSERT_EQ(calendar.AddBusinessDays(day, count), expected) << "day " << day << " count " << count;
+    }
+  }
+}
+
+TEST(BusinessCalendar, IgnoresWeekendHolidays) {
+  ZoneOffsets zone{int64_t{0}};
+  // 2024-06-15 is a Saturday
+  const std::vector<double> holidays{static_cast<double>(UtcMilliseconds(2024, 6, 15, 12))};
+  const BusinessCalendar calendar{std::span<const double>{holidays}, zone};
+  const int64_t friday = DaysFromCivil(2024, 6, 14);
+  EXPECT_EQ(calendar.AddBusinessDays(friday, 1), DaysFromCivil(2024, 6, 17));
+}
+
+TEST(AddCalendarOffset, Int64SpansMatchDoubleSpans) {
+  const EasternClock clock{0};
+  std::mt19937_64 random{7};
+  std::uniform_int_distribution<int64_t> offset{0, 2 * 365 * kMillisecondsPerDay};
+  std::vector<double> values(5000);
+  std::vector<int64_t> wide(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    wide[i] = UtcMilliseconds(2023, 1, 1) + offset(random);
+    values[i] = static_cast<double>(wide[i]);
+  }
+
+  ZoneOffsets zone{clock};
+  winrt::DateTimePicker::Helpers::AddCalendarOffset(std::span<double>{values}, {0, 1, 3}, zone);
+  winrt::DateTimePicker::Helpers::AddCalendarOffset(std::span<int64_t>{wide}, {0, 1, 3}, zone);
+  const std::vector<double> holidays{static_cast<double>(UtcMilliseconds(2024, 7, 4, 12))};
+  const BusinessCalendar calendar{std::span<const double>{holidays}, zone};
+  AddBusinessDays(std::span<double>{values}, -7, calendar, zone);
+  AddBusinessDays(std::span<int64_t>{wide}, -7, calendar, zone);
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], static_cast<double>(wide[i])) << i;
+  }
+}
+
+TEST(ClampTimestamps, ClampsBothElementTypes) {
+  std::vector<double> values{1, 5, 10, std::nan("")};
+  ClampTimestamps(std::span<double>{values}, 2.0, 8.0);
+  EXPECT_EQ(values[0], 2);
+  EXPECT_EQ(values[1], 5);
+  EXPECT_EQ(values[2], 8);
+  EXPECT_TRUE(std::isnan(values[3]));
+
+  std::vector<int64_t> wide{1, 10, kInvalidTimestamp64};
+  ClampTimestamps(std::span<int64_t>{wide}, 2.5, std::nullopt);
+  EXPECT_EQ(wide[0], 3);
+  EXPECT_EQ(wide[1], 10);
+  EXPECT_EQ(wide[2], kInvalidTimestamp64);
+}
+
+TEST(IntersectRanges, MergesAndIntersects) {
+  const std::vector<double> first{10, 20, 15, 30, 40, 50};
+  const std::vector<int64_t> second{25, 45};
+  const auto intersection = IntersectRanges(std::span<const double>{first}, std::span<const int64_t>{second});
+  EXPECT_EQ(intersection, (std::vector<double>{25, 30, 40, 45}));
+}
+
+} // namespace
@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "DayAnchor.h"
+#include "TestClocks.h"
+
+#include <gtest/gtest.h>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+constexpr int64_t kHour = 3600 * 1000;
+
+TEST(DayAnchor, AnchorsTheLocalDayInAFixedOffset) {
+  // 23:30 UTC on June 14 is already June 15 at UTC+2
+  const auto clock = std::make_shared<FixedOffsetClock>(UtcMilliseconds(2024, 6, 14, 23, 30), 2 * 3600);
+  DayAnchor anchor{clock};
+
+  EXPECT_EQ(anchor.LocalMidnightMilliseconds(), UtcMilliseconds(2024, 6, 14, 22));
+  EXPECT_EQ(anchor.NextBoundaryMilliseconds(), UtcMilliseconds(2024, 6, 15, 22));
+  ASSERT_TRUE(anchor.Today().uniformOffsetSeconds);
+  EXPECT_EQ(*anchor.Today().uniformOffsetSeconds, 2 * 3600);
+}
+
+TEST(DayAnchor, RefreshReturnsTheDelayToTheNextBoundary) {
+  const auto clock = std::make_shared<FixedOffsetClock>(UtcMilliseconds(2024, 6, 15, 21), 2 * 3600);
+  DayAnchor anchor{clock};
+  EXPECT_EQ(anchor.Refresh(), kHour);
+
+  clock->SetNow(UtcMilliseconds(2024, 6, 15, 22));
+  EXPECT_EQ(anchor.Refresh(), 24 * kHour);
+  EXPECT_EQ(anchor.LocalMidnightMilliseconds(), UtcMilliseconds(2024, 6, 15, 22));
+}
+
+TEST(DayAnchor, DelayToTheNextBoundaryIsReadWithoutRefreshing) {
+  const auto clock = std::make_shared<FixedOffsetClock>(UtcMilliseconds(2024, 6, 15, 21), 2 * 3600);
+  DayAnchor anchor{clock};
+  EXPECT_EQ(anchor.MillisecondsUntilNextBoundary(), kHour);
+
+  // Past the boundary the anchor stays as it was, and the delay does not go negative
+  clock->SetNow(UtcMilliseconds(2024, 6, 15, 23));
+  EXPECT_EQ(anchor.MillisecondsUntilNextBoundary(), 0);
+  EXPECT_EQ(anchor.NextBoundaryMilliseconds(), UtcMilliseconds(2024, 6, 15, 22));
+}
+
+TEST(DayAnchor, SpringForwardDayIsTwentyThreeHoursLong) {
+  const auto clock = std::make_shared<EasternClock>(EasternMilliseconds(2024, 3, 9, 20));
+  DayAnchor anchor{clock};
+  ASSERT_TRUE(anchor.Today().uniformOffsetSeconds);
+
+  clock->SetNow(anchor.NextBoundaryMilliseconds());
+  EXPECT_EQ(anchor.Refresh(), 23 * kHour);
+  EXPECT_EQ(anchor.LocalMidnightMilliseconds(), EasternMilliseconds(2024, 3, 10, 0));
+  EXPECT_EQ(anchor.NextBoundaryMilliseconds(), EasternMilliseconds(2024, 3, 11, 0));
+  EXPECT_FALSE(anchor.Today().uniformOffsetSeconds);
+
+  clock->SetNow(anchor.NextBoundaryMilliseconds());
+  EXPECT_EQ(anchor.Refresh(), 24 * kHour);
+  ASSERT_TRUE(anchor.Today().uniformOffsetSeconds);
+  EXPECT_EQ(*anchor.Today().uniformOffsetSeconds, -4 * 3600);
+}
+
+TEST(DayAnchor, FallBackDayIsTwentyFiveHoursLong) {
+  const auto clock = std::make_shared<EasternClock>(EasternMilliseconds(2024, 11, 3, 12));
+  DayAnchor anchor{clock};
+
+  EXPECT_EQ(anchor.LocalMidnightMilliseconds(), UtcMilliseconds(2024, 11, 3, 4));
+  EXPECT_EQ(anchor.NextBoundaryMilliseconds(), UtcMilliseconds(2024, 11, 4, 5));
+  EXPECT_FALSE(anchor.Today().uniformOffsetSeconds);
+}
+
+TEST(DayAnchor, TodayAtUsesTheOffsetInEffectAtThatTime) {
+  const auto clock = std::make_shared<EasternClock>(EasternMilliseconds(2024, 3, 10, 12));
+  DayAnchor anchor{clock};
+
+  // Before and after the 02:00 EST transition
+  EXPECT_EQ(anchor.TodayAt(1 * kHour), UtcMilliseconds(2024, 3, 10, 6));
+  EXPECT_EQ(anchor.TodayAt(9 * kHour), UtcMilliseconds(2024, 3, 10, 13));
+  EXPECT_EQ(anchor.TodayAt(9 * kHour), EasternMilliseconds(2024, 3, 10, 9));
+  // 02:30 does not exist that day and maps past the transition
+  EXPECT_EQ(anchor.TodayAt(2 * kHour + 30 * 60 * 1000), UtcMilliseconds(2024, 3, 10, 7, 30));
+
+  clock->SetNow(EasternMilliseconds(2024, 11, 3, 12));
+  anchor.Refresh();
+  EXPECT_EQ(anchor.TodayAt(9 * kHour), UtcMilliseconds(2024, 11, 3, 14));
+  // 01:30 happens twice; the first occurrence is reported
+  EXPECT_EQ(anchor.TodayAt(kHour + 30 * 60 * 1000), UtcMilliseconds(2024, 11, 3, 5, 30));
+}
+
+TEST(DayAnchor, LocalTimeOfDayFollowsTheOffsetOfTheInstant) {
+  const auto clock = std::make_shared<EasternClock>(EasternMilliseconds(2024, 3, 10, 12));
+  DayAnchor anchor{clock};
+
+  EXPECT_EQ(anchor.LocalTimeOfDayMilliseconds(UtcMilliseconds(2024, 3, 10, 6)), 1 * kHour);
+  EXPECT_EQ(anchor.LocalTimeOfDayMilliseconds(UtcMilliseconds(2024, 3, 10, 13)), 9 * kHour);
+  // Instants outside today use the clock's rules
+  EXPECT_EQ(anchor.LocalTimeOfDayMilliseconds(UtcMilliseconds(2024, 1, 10, 13)), 8 * kHour);
+}
+
+} // namespace
@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "EventBatcher.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+
+namespace {
+
+// Frames run only when the test says so
+class ManualFrameScheduler final : public IFrameScheduler {
+public:
+  void RequestFrame(std::function<void()> onFrame) override {
+    m_requests.push_back(std::move(onFrame));
+  }
+
+  size_t Requested() const noexcept {
+    return m_requests.size();
+  }
+
+  void RunFrame() {
+    auto requests = std::move(m_requests);
+    m_requests.clear();
+    for (auto &request : requests) {
+      request();
+    }
+  }
+
+private:
+  std::vector<std::function<void()>> m_requests;
+};
+
+using Batcher = EventBatcher<int>;
+
+struct BatchFixture {
+  explicit BatchFixture(size_t maxBatchSize = Batcher::kDefaultMaxBatchSize)
+      : scheduler(std::make_shared<ManualFrameScheduler>()),
+        batcher(
+            scheduler,
+            [this](std::vector<Batcher::Entry> &&entries) { batches.push_back(std::move(entries)); },
+            maxBatchSize) {}
+
+  std::shared_ptr<ManualFrameScheduler> scheduler;
+  std::vector<std::vector<Batcher::Entry>> batches;
+  Batcher batcher;
+};
+
+TEST(EventBatcher, DeliversOneBatchPerFrame) {
+  BatchFixture fixture;
+  fixture.batcher.Enqueue(1, 10);
+  fixture.batcher.Enqueue(2, 20);
+  fixture.batcher.Enqueue(3, 30);
+
+  EXPECT_EQ(fixture.scheduler->Requested(), 1u);
+  EXPECT_TRUE(fixture.batches.empty());
+
+  fixture.scheduler->RunFrame();
+  ASSERT_EQ(fixture.batches.size(), 1u);
+  ASSERT_EQ(fixture.batches[0].size(), 3u);
+  EXPECT_EQ(fixture.batches[0][0].tag, 1);
+  EXPECT_EQ(fixture.batches[0][2].payload, 30);
+}
+
+TEST(EventBatcher, KeepsTheLatestEventOfEachViewWithinAFrame) {
+  BatchFixture fixture;
+  fixture.batcher.Enqueue(1, 10);
+  fixture.batcher.Enqueue(2, 20);
+  fixture.batcher.Enqueue(1, 11);
+
+  fixture.scheduler->RunFrame();
+  ASSERT_EQ(fixture.batches.size(), 1u);
+  ASSERT_EQ(fixture.batches[0].size(), 2u);
+  EXPECT_EQ(fixture.batches[0][0].tag, 1);
+  EXPECT_EQ(fixture.batches[0][0].payload, 11);
+  EXPECT_TRUE(fixture.batches[0][0].valuesSkipped);
+  EXPECT_FALSE(fixture.batches[0][1].valuesSkipped);
+}
+
+TEST(EventBatcher, RequestsANewFrameAfterEachFlush) {
+  BatchFixture fixture;
+  fixture.batcher.Enqueue(1, 10);
+  fixture.scheduler->RunFrame();
+  fixture.scheduler->RunFrame();
+  EXPECT_EQ(fixture.batches.size(), 1u);
+
+  fixture.batcher.Enqueue(1, 11);
+  EXPECT_EQ(fixture.scheduler->Requested(), 1u);
+  fixture.scheduler->RunFrame();
+  ASSERT_EQ(fixture.batches.size(), 2u);
+  EXPECT_EQ(fixture.batches[1][0].payload, 11);
+  EXPECT_FALSE(fixture.batches[1][0].valuesSkipped);
+}
+
+TEST(EventBatcher, DeliversAFullBatchWithoutWaitingForTheFrame) {
+  BatchFixture fixture{4};
+  for (int tag = 1; tag <= 4; ++tag) {
+    fixture.batcher.Enqueue(tag, tag * 10);
+  }
+  ASSERT_EQ(fixture.batches.size(), 1u);
+  EXPECT_EQ(fixture.batches[0].size(), 4u);
+
+  // Updates of views already queued do not grow the batch
+  fixture.batcher.Enqueue(5, 50);
+  fixture.batcher.Enqueue(5, 51);
+  EXPECT_EQ(fixture.batches.size(), 1u);
+
+  // The frame still delivers what came after the early batch
+  fixture.scheduler->RunFrame();
+  ASSERT_EQ(fixture.batches.size(), 2u);
+  ASSERT_EQ(fixture.batches[1].size(), 1u);
+  EXPECT_EQ(fixture.batches[1][0].payload, 51);
+  EXPECT_TRUE(fixture.batches[1][0].valuesSkipped);
+  EXPECT_EQ(fixture.scheduler->Requested(), 0u);
+}
+
+TEST(EventBatcher, ViewsInAnEarlyBatchStartOverInTheNext) {
+  BatchFixture fixture{2};
+  fixture.batcher.Enqueue(1, 10);
+  fixture.batcher.Enqueue(2, 20);
+  ASSERT_EQ(fixture.batches.size(), 1u);
+
+  // Not a replacement: the earlier event was already delivered
+  fixture.batcher.Enqueue(1, 11);
+  fixture.scheduler->RunFrame();
+  ASSERT_EQ(fixture.batches.size(), 2u);
+  ASSERT_EQ(fixture.batches[1].size(), 1u);
+  EXPECT_EQ(fixture.batches[1][0].payload, 11);
+  EXPECT_FALSE(fixture.batches[1][0].valuesSkipped);
+}
+
+} // namespace
@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "EventQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+
+namespace {
+
+using Delivered = std::vector<std::pair<int64_t, bool>>;
+
+template <typename TQueue>
+Delivered DrainAll(TQueue &queue) {
+  Delivered delivered;
+  queue.Drain([&](int64_t value, bool valuesSkipped) { delivered.emplace_back(value, valuesSkipped); });
+  return delivered;
+}
+
+TEST(BoundedEventQueue, DeliversInOrderAndAsksForOneDrain) {
+  EventQueueMetrics metrics;
+  BoundedEventQueue<int64_t, 4> queue{metrics};
+
+  EXPECT_TRUE(queue.Push(1));
+  EXPECT_FALSE(queue.Push(2));
+  EXPECT_FALSE(queue.Push(3));
+  EXPECT_EQ(queue.Depth(), 3u);
+  EXPECT_EQ(metrics.pending.load(), 3);
+
+  EXPECT_EQ(DrainAll(queue), (Delivered{{1, false}, {2, false}, {3, false}}));
+  EXPECT_EQ(queue.Depth(), 0u);
+  EXPECT_EQ(metrics.pending.load(), 0);
+  EXPECT_EQ(metrics.delivered.load(), 3);
+
+  // The next push needs a new drain
+  EXPECT_TRUE(queue.Push(4));
+}
+
+TEST(BoundedEventQueue, KeepsTheLatestValueOnOverflow) {
+  EventQueueMetrics metrics;
+  BoundedEventQueue<int64_t, 4> queue{metrics};
+  for (int64_t value = 1; value <= 10; ++value) {
+    queue.Push(value);
+  }
+
+  // Four in the ring, the fifth took the overflow slot and values 6 to 10 replaced it
+  EXPECT_EQ(queue.Depth(), 5u);
+  EXPECT_EQ(queue.Dropped(), 5u);
+  EXPECT_EQ(metrics.dropped.load(), 5);
+  EXPECT_EQ(metrics.maxDepth.load(), 5);
+
+  EXPECT_EQ(DrainAll(queue), (Delivered{{1, false}, {2, false}, {3, false}, {4, false}, {10, true}}));
+  EXPECT_EQ(metrics.pending.load(), 0);
+}
+
+TEST(BoundedEventQueue, SingleOverflowIsNotFlaggedAsSkipping) {
+  EventQueueMetrics metrics;
+  BoundedEventQueue<int64_t, 2> queue{metrics};
+  queue.Push(1);
+  queue.Push(2);
+  queue.Push(3);
+
+  EXPECT_EQ(queue.Dropped(), 0u);
+  EXPECT_EQ(DrainAll(queue), (Delivered{{1, false}, {2, false}, {3, false}}));
+}
+
+TEST(BoundedEventQueue, PushDuringDrainReplacesTheOverflow) {
+  EventQueueMetrics metrics;
+  BoundedEventQueue<int64_t, 2> queue{metrics};
+  queue.Push(1);
+  queue.Push(2);
+  queue.Push(3); // overflow
+  queue.Push(4); // replaces the overflow
+
+  Delivered delivered;
+  queue.Drain([&](int64_t value, bool valuesSkipped) {
+    delivered.emplace_back(value, valuesSkipped);
+    if (value == 1) {
+      // Pushed while the drain runs; the overflow is still active, so this replaces it
+      queue.Push(5);
+    }
+  });
+  EXPECT_EQ(delivered, (Delivered{{1, false}, {2, false}, {5, true}}));
+}
+
+TEST(BoundedEventQueue, DestructionReleasesPendingMetrics) {
+  EventQueueMetrics metrics;
+  {
+    BoundedEventQueue<int64_t, 4> queue{metrics};
+    queue.Push(1);
+    queue.Push(2);
+    EXPECT_EQ(metrics.pending.load(), 2);
+  }
+  EXPECT_EQ(metrics.pending.load(), 0);
+}
+
+TEST(BoundedEventQueue, StressWithABusyConsumer) {
+  EventQueueMetrics metrics;
+  BoundedEventQueue<int64_t, 8> queue{metrics};
+  constexpr int64_t kEvents = 200000;
+
+  std::atomic<int> drainsRequested{0};
+  std::atomic<bool> producerDone{false};
+  std::vector<std::pair<int64_t, bool>> delivered;
+
+  std::thread consumer{[&] {
+    int drainsDone = 0;
+    for (;;) {
+      const bool finished = producerDone.load(std::memory_order_acquire);
+      if (drainsDone < drainsRequested.load(std::memory_order_acquire)) {
+        ++drainsDone;
+        queue.Drain([&](int64_t value, bool valuesSkipped) {
+          delivered.emplace_back(value, valuesSkipped);
+          // A slow consumer, so the ring overflows now and then
+          if (value % 1000 == 0) {
+            std::this_thread::yield();
+          }
+        });
+      } else if (finished) {
+        break;
+      }
+    }
+  }};
+
+  for (int64_t value = 1; value <= kEvents; ++value) {
+    if (queue.Push(value)) {
+      drainsRequested.fetch_add(1, std::memory_order_release);
+    }
+  }
+  producerDone.store(true, std::memory_order_release);
+  consumer.join();
+
+  // Values arrive in order, the last one always does, and everything else is accounted for
+  ASSERT_FALSE(delivered.empty());
+  EXPECT_EQ(delivered.back().first, kEvents);
+  for (size_t i = 1; i < delivered.size(); ++i) {
+    ASSERT_LT(delivered[i - 1].first, delivered[i].first);
+  }
+  EXPECT_EQ(static_cast<int64_t>(delivered.size()) + static_cast<int64_t>(queue.Dropped()), kEvents);
+  EXPECT_EQ(metrics.pending.load(), 0);
+  EXPECT_LE(metrics.maxDepth.load(), 9);
+  const auto skippedFlags = std::count_if(delivered.begin(), delivered.end(), [](const auto &event) { return event.second; });
+  EXPECT_EQ(skippedFlags > 0, queue.Dropped() > 0);
+}
+
+} // namespace
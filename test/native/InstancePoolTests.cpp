@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "InstancePool.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+
+namespace {
+
+// Stands in for a control: counts how often it was reset, and whether a reset should fail
+struct FakeControl {
+  int id{0};
+  int resets{0};
+  bool failReset{false};
+};
+
+using ControlPtr = std::shared_ptr<FakeControl>;
+
+struct PoolFixture {
+  explicit PoolFixture(size_t capacity)
+      : pool(
+            capacity,
+            [this]() { return std::make_shared<FakeControl>(FakeControl{++created}); },
+            [](ControlPtr &control) {
+              ++control->resets;
+              return !control->failReset;
+            },
+            metrics) {}
+
+  int created{0};
+  InstancePoolMetrics metrics;
+  InstancePool<ControlPtr> pool;
+};
+
+TEST(InstancePool, ReusesReleasedInstancesAfterResettingThem) {
+  PoolFixture fixture{4};
+  auto first = fixture.pool.Acquire();
+  EXPECT_EQ(fixture.metrics.misses.load(), 1);
+
+  EXPECT_TRUE(fixture.pool.Release(first));
+  EXPECT_EQ(first->resets, 1);
+  EXPECT_EQ(fixture.pool.Size(), 1u);
+
+  EXPECT_EQ(fixture.pool.Acquire(), first);
+  EXPECT_EQ(fixture.metrics.hits.load(), 1);
+  EXPECT_EQ(fixture.metrics.returned.load(), 1);
+  EXPECT_EQ(fixture.created, 1);
+}
+
+TEST(InstancePool, DiscardsInstancesPastTheCapacity) {
+  PoolFixture fixture{2};
+  std::vector<ControlPtr> controls;
+  for (int i = 0; i < 3; ++i) {
+    controls.push_back(fixture.pool.Acquire());
+  }
+  for (const auto &control : controls) {
+    fixture.pool.Release(control);
+  }
+
+  EXPECT_EQ(fixture.pool.Size(), 2u);
+  EXPECT_EQ(fixture.metrics.returned.load(), 2);
+  EXPECT_EQ(fixture.metrics.discarded.load(), 1);
+  // Instances past the capacity are dropped without being reset
+  EXPECT_EQ(controls[2]->resets, 0);
+}
+
+TEST(InstancePool, DiscardsInstancesThatFailToReset) {
+  PoolFixture fixture{4};
+  auto control = fixture.pool.Acquire();
+  control->failReset = true;
+
+  EXPECT_FALSE(fixture.pool.Release(control));
+  EXPECT_EQ(fixture.pool.Size(), 0u);
+  EXPECT_EQ(fixture.metrics.discarded.load(), 1);
+  EXPECT_NE(fixture.pool.Acquire(), control);
+}
+
+TEST(InstancePool, WarmsUpToTheTargetButNotPastTheCapacity) {
+  PoolFixture fixture{3};
+  EXPECT_FALSE(fixture.pool.WarmStep());
+  EXPECT_EQ(fixture.created, 0);
+
+  fixture.pool.WarmTarget(5);
+  EXPECT_EQ(fixture.pool.WarmTarget(), 3u);
+  int steps = 1;
+  while (fixture.pool.WarmStep()) {
+    ++steps;
+  }
+  EXPECT_EQ(steps, 3);
+  EXPECT_EQ(fixture.pool.Size(), 3u);
+  EXPECT_EQ(fixture.metrics.warmed.load(), 3);
+  EXPECT_FALSE(fixture.pool.WarmStep());
+
+  // Warmed instances serve acquisitions as hits
+  fixture.pool.Acquire();
+  EXPECT_EQ(fixture.metrics.hits.load(), 1);
+  EXPECT_EQ(fixture.metrics.misses.load(), 0);
+}
+
+TEST(InstancePool, ClearAndTakeAllEmptyThePool) {
+  PoolFixture fixture{4};
+  fixture.pool.WarmTarget(3);
+  while (fixture.pool.WarmStep()) {
+  }
+
+  auto taken = fixture.pool.TakeAll();
+  EXPECT_EQ(taken.size(), 3u);
+  EXPECT_EQ(fixture.pool.Size(), 0u);
+
+  for (const auto &control : taken) {
+    fixture.pool.Release(control);
+  }
+  fixture.pool.Clear();
+  EXPECT_EQ(fixture.pool.Size(), 0u);
+  for (const auto &control : taken) {
+    EXPECT_EQ(control.use_count(), 1);
+  }
+
+  // The pool keeps working after being emptied
+  fixture.pool.Acquire();
+  EXPECT_EQ(fixture.created, 4);
+}
+
+} // namespace
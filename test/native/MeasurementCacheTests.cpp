@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "RNDateTimePickerMeasurementCache.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace facebook::react;
+
+namespace {
+
+RNDateTimePickerMeasurementKey KeyFor(const std::string &locale) {
+  RNDateTimePickerMeasurementKey key;
+  key.locale = locale;
+  return key;
+}
+
+TEST(MeasurementCache, EvictsTheLeastRecentlyUsedEntry) {
+  RNDateTimePickerMeasurementCache cache{3};
+  cache.set(KeyFor("a"), Size{1, 1});
+  cache.set(KeyFor("b"), Size{2, 2});
+  cache.set(KeyFor("c"), Size{3, 3});
+
+  // Reading "a" makes "b" the oldest
+  ASSERT_TRUE(cache.get(KeyFor("a")));
+  cache.set(KeyFor("d"), Size{4, 4});
+
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_FALSE(cache.get(KeyFor("b")));
+  EXPECT_EQ(cache.get(KeyFor("a")), (Size{1, 1}));
+  EXPECT_EQ(cache.get(KeyFor("c")), (Size{3, 3}));
+  EXPECT_EQ(cache.get(KeyFor("d")), (Size{4, 4}));
+}
+
+TEST(MeasurementCache, UpdatingAnEntryRefreshesItWithoutGrowing) {
+  RNDateTimePickerMeasurementCache cache{2};
+  cache.set(KeyFor("a"), Size{1, 1});
+  cache.set(KeyFor("b"), Size{2, 2});
+  cache.set(KeyFor("a"), Size{5, 5});
+  cache.set(KeyFor("c"), Size{3, 3});
+
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_FALSE(cache.get(KeyFor("b")));
+  EXPECT_EQ(cache.get(KeyFor("a")), (Size{5, 5}));
+}
+
+TEST(MeasurementCache, EveryKeyFieldSeparatesEntries) {
+  RNDateTimePickerMeasurementCache cache;
+  const auto base = KeyFor("en_US");
+  cache.set(base, Size{1, 1});
+
+  auto mode = base;
+  mode.mode = 1;
+  auto display = base;
+  display.display = 2;
+  auto fontScale = base;
+  fontScale.fontScale = 1.5;
+  auto is24Hour = base;
+  is24Hour.is24Hour = true;
+  for (const auto &key : {mode, display, fontScale, is24Hour}) {
+    EXPECT_FALSE(cache.get(key));
+  }
+  EXPECT_TRUE(cache.get(base));
+}
+
+TEST(MeasurementCache, RevisionCountsOnlyChanges) {
+  RNDateTimePickerMeasurementCache cache;
+  cache.set(KeyFor("a"), Size{1, 1});
+  const auto revision = cache.revision();
+
+  cache.set(KeyFor("a"), Size{1, 1});
+  EXPECT_EQ(cache.revision(), revision);
+  cache.set(KeyFor("a"), Size{1, 2});
+  EXPECT_EQ(cache.revision(), revision + 1);
+}
+
+TEST(MeasurementCache, RestoreKeepsMeasuredEntriesAndRespectsCapacity) {
+  RNDateTimePickerMeasurementCache cache{3};
+  cache.set(KeyFor("a"), Size{1, 1});
+  cache.restore({{KeyFor("a"), Size{9, 9}}, {KeyFor("b"), Size{2, 2}}, {KeyFor("c"), Size{3, 3}}, {KeyFor("d"), Size{4, 4}}});
+
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_EQ(cache.get(KeyFor("a")), (Size{1, 1}));
+  EXPECT_FALSE(cache.get(KeyFor("d")));
+
+  // Restored entries queue behind the measured ones, in their persisted order
+  cache.set(KeyFor("e"), Size{5, 5});
+  EXPECT_FALSE(cache.get(KeyFor("c")));
+  EXPECT_TRUE(cache.get(KeyFor("a")));
+  EXPECT_TRUE(cache.get(KeyFor("b")));
+}
+
+TEST(MeasurementCache, IntrinsicSizesFollowTheReportedFontScaleAndClockFormat) {
+  RNDateTimePickerMeasurementCache cache;
+  EXPECT_FALSE(cache.intrinsicSize(0, 2, "en_US"));
+
+  auto key = KeyFor("en_US");
+  key.display = 2;
+  key.is24Hour = true;
+  cache.setIntrinsicSize(key, Size{120, 34});
+  EXPECT_EQ(cache.intrinsicSize(0, 2, "en_US"), (Size{120, 34}));
+
+  // Once a picker reports a larger text size, sizes measured before no longer apply
+  auto scaled = key;
+  scaled.mode = 1;
+  scaled.fontScale = 1.5;
+  cache.setIntrinsicSize(scaled, Size{150, 51});
+  EXPECT_FALSE(cache.intrinsicSize(0, 2, "en_US"));
+  EXPECT_EQ(cache.intrinsicSize(1, 2, "en_US"), (Size{150, 51}));
+
+  cache.clear();
+  EXPECT_FALSE(cache.intrinsicSize(1, 2, "en_US"));
+}
+
+} // namespace
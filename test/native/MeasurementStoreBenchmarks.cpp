@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "RNDateTimePickerMeasurementStore.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+
+using namespace facebook::react;
+
+namespace {
+
+using Store = RNDateTimePickerMeasurementStore;
+
+constexpr char kOsVersion[] = "Version 17.4 (Build 21E213)";
+
+// A full cache: one entry per configuration, with compact-style locale keys
+Store::Entries FullCache() {
+  Store::Entries entries;
+  for (size_t i = 0; i < RNDateTimePickerMeasurementCache::kDefaultCapacity; ++i) {
+    RNDateTimePickerMeasurementKey key;
+    key.mode = static_cast<int>(i % 4);
+    key.display = static_cast<int>(i % 5);
+    key.locale = "en_US|Mar " + std::to_string(i + 1) + ", 2024 at 9:41 AM";
+    key.fontScale = 1 + static_cast<double>(i % 3) * 0.5;
+    key.is24Hour = i % 2 == 0;
+    entries.emplace_back(key, Size{320, 216 + static_cast<double>(i)});
+  }
+  return entries;
+}
+
+void BM_EncodeMeasurements(benchmark::State &state) {
+  const auto entries = FullCache();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Store::encode(entries, kOsVersion));
+  }
+}
+BENCHMARK(BM_EncodeMeasurements);
+
+void BM_DecodeMeasurements(benchmark::State &state) {
+  const auto data = Store::encode(FullCache(), kOsVersion);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Store::decode(data.data(), data.size(), kOsVersion));
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(BM_DecodeMeasurements);
+
+// What the first picker of a launch waits for at most: open, map, verify and parse the file
+void BM_LoadMeasurements(benchmark::State &state) {
+  const auto path =
+      (std::filesystem::temp_directory_path() / ("RNDateTimePickerMeasurementsBenchmark-" + std::to_string(::getpid())))
+          .string();
+  if (!Store::save(path, Store::encode(FullCache(), kOsVersion))) {
+    state.SkipWithError("could not write the measurement file");
+    return;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Store::load(path, kOsVersion));
+  }
+  std::remove(path.c_str());
+}
+BENCHMARK(BM_LoadMeasurements);
+
+} // namespace
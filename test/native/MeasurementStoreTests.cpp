@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "RNDateTimePickerMeasurementStore.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+using Store = RNDateTimePickerMeasurementStore;
+
+constexpr char kOsVersion[] = "Version 17.4 (Build 21E213)";
+
+Store::Entries SampleEntries() {
+  Store::Entries entries;
+  for (int i = 0; i < 8; ++i) {
+    RNDateTimePickerMeasurementKey key;
+    key.mode = i % 4;
+    key.display = i % 3;
+    key.locale = i % 2 ? "en_US" : "de_DE|12. März 2024";
+    key.fontScale = 1 + i * 0.25;
+    key.is24Hour = i % 2 == 0;
+    entries.emplace_back(key, Size{300 + i * 0.5, 216.0 + i});
+  }
+  return entries;
+}
+
+Store::Entries Decode(const std::vector<uint8_t> &data, const std::string &osVersion = kOsVersion) {
+  return Store::decode(data.data(), data.size(), osVersion);
+}
+
+// Same FNV-1a as the store, so tests can forge blobs that pass the checksum
+void RewriteChecksum(std::vector<uint8_t> &data) {
+  const size_t payloadLength = data.size() - sizeof(uint32_t);
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < payloadLength; ++i) {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  std::memcpy(data.data() + payloadLength, &hash, sizeof(hash));
+}
+
+class TemporaryFile {
+public:
+  explicit TemporaryFile(const char *name)
+      : m_path((std::filesystem::temp_directory_path() / (std::string{name} + "-" + std::to_string(::getpid()))).string()) {}
+
+  ~TemporaryFile() {
+    std::remove(m_path.c_str());
+    std::remove((m_path + ".tmp").c_str());
+  }
+
+  const std::string &Path() const {
+    return m_path;
+  }
+
+private:
+  std::string m_path;
+};
+
+TEST(MeasurementStore, RoundTripsEntriesInOrder) {
+  const auto entries = SampleEntries();
+  EXPECT_EQ(Decode(Store::encode(entries, kOsVersion)), entries);
+  EXPECT_TRUE(Decode(Store::encode({}, kOsVersion)).empty());
+}
+
+TEST(MeasurementStore, RejectsAnyCorruptedByte) {
+  const auto data = Store::encode(SampleEntries(), kOsVersion);
+  for (size_t i = 0; i < data.size(); ++i) {
+    auto corrupted = data;
+    corrupted[i] ^= 0x20;
+    EXPECT_TRUE(Decode(corrupted).empty()) << "byte " << i;
+  }
+}
+
+TEST(MeasurementStore, RejectsTruncatedAndExtendedBlobs) {
+  const auto data = Store::encode(SampleEntries(), kOsVersion);
+  for (size_t length = 0; length < data.size(); ++length) {
+    EXPECT_TRUE(Store::decode(data.data(), length, kOsVersion).empty()) << "length " << length;
+  }
+  EXPECT_TRUE(Store::decode(nullptr, 0, kOsVersion).empty());
+
+  // Trailing bytes are rejected even behind a valid checksum
+  auto extended = data;
+  extended.insert(extended.end() - sizeof(uint32_t), {0, 0, 0, 0});
+  RewriteChecksum(extended);
+  EXPECT_TRUE(Decode(extended).empty());
+}
+
+TEST(MeasurementStore, RejectsOtherFormatsAndOsVersions) {
+  const auto data = Store::encode(SampleEntries(), kOsVersion);
+  EXPECT_TRUE(Decode(data, "Version 17.5 (Build 21F79)").empty());
+  EXPECT_TRUE(Decode(data, "").empty());
+
+  auto otherMagic = data;
+  otherMagic[0] ^= 1;
+  RewriteChecksum(otherMagic);
+  EXPECT_TRUE(Decode(otherMagic).empty());
+
+  auto otherVersion = data;
+  const uint32_t nextVersion = Store::kFormatVersion + 1;
+  std::memcpy(otherVersion.data() + sizeof(uint32_t), &nextVersion, sizeof(nextVersion));
+  RewriteChecksum(otherVersion);
+  EXPECT_TRUE(Decode(otherVersion).empty());
+
+  // The forging itself is sound: an untouched blob with a rewritten checksum still loads
+  auto rewritten = data;
+  RewriteChecksum(rewritten);
+  EXPECT_EQ(Decode(rewritten), SampleEntries());
+}
+
+TEST(MeasurementStore, SavesAndLoadsFiles) {
+  TemporaryFile file{"RNDateTimePickerMeasurementStoreTest"};
+  EXPECT_TRUE(Store::load(file.Path(), kOsVersion).empty());
+
+  ASSERT_TRUE(Store::save(file.Path(), Store::encode(SampleEntries(), kOsVersion)));
+  EXPECT_FALSE(std::filesystem::exists(file.Path() + ".tmp"));
+  EXPECT_EQ(Store::load(file.Path(), kOsVersion), SampleEntries());
+  EXPECT_TRUE(Store::load(file.Path(), "Version 18.0").empty());
+
+  // Saving replaces the previous contents
+  ASSERT_TRUE(Store::save(file.Path(), Store::encode({}, kOsVersion)));
+  EXPECT_TRUE(Store::load(file.Path(), kOsVersion).empty());
+}
+
+TEST(MeasurementStore, LoadsCorruptedAndEmptyFilesAsEmpty) {
+  TemporaryFile file{"RNDateTimePickerMeasurementStoreCorruptTest"};
+  std::ofstream{file.Path(), std::ios::binary}.close();
+  EXPECT_TRUE(Store::load(file.Path(), kOsVersion).empty());
+
+  auto data = Store::encode(SampleEntries(), kOsVersion);
+  data[data.size() / 2] ^= 0xFF;
+  ASSERT_TRUE(Store::save(file.Path(), data));
+  EXPECT_TRUE(Store::load(file.Path(), kOsVersion).empty());
+}
+
+TEST(MeasurementStore, SaveFailsForAMissingDirectory) {
+  const auto path = (std::filesystem::temp_directory_path() / "rndtp-missing-directory" / "measurements.bin").string();
+  EXPECT_FALSE(Store::save(path, Store::encode(SampleEntries(), kOsVersion)));
+}
+
+} // namespace
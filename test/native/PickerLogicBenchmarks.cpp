@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HeadlessControls.h"
+#include "PickerLogic.h"
+#include "TestClocks.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+constexpr int64_t kNoon = UtcMilliseconds(2024, 6, 15, 12);
+
+MapPropReader DateProps() {
+  return MapPropReader{{
+      {"selectedDate", kNoon},
+      {"minDate", kNoon - 1000 * 3600 * 24},
+      {"maxDate", kNoon + 1000 * 3600 * 24},
+      {"dateFormat", "{month.full} {day.integer}"},
+      {"timeZoneOffsetInSeconds", int64_t{-4 * 3600}},
+  }};
+}
+
+MapPropReader TimeProps() {
+  return MapPropReader{{{"selectedTime", kNoon}, {"is24Hour", true}, {"minuteInterval", int64_t{5}}}};
+}
+
+// Work done where the props are parsed
+void BM_DatePickerBuildPlan(benchmark::State &state) {
+  DatePickerLogic logic;
+  const auto props = DateProps();
+  PickerApplyStats stats;
+  for (auto _ : state) {
+    auto plan = logic.BuildPlan(props, stats);
+    benchmark::DoNotOptimize(plan);
+  }
+}
+BENCHMARK(BM_DatePickerBuildPlan);
+
+// Work left for the UI thread
+void BM_DatePickerApply(benchmark::State &state) {
+  DatePickerLogic logic;
+  HeadlessDateControl control;
+  PickerApplyStats stats;
+  const auto plan = logic.BuildPlan(DateProps(), stats);
+  for (auto _ : state) {
+    logic.Apply(plan, control, stats);
+    benchmark::DoNotOptimize(control.date);
+  }
+}
+BENCHMARK(BM_DatePickerApply);
+
+void BM_TimePickerBuildPlan(benchmark::State &state) {
+  DayAnchor anchor{std::make_shared<FixedOffsetClock>(kNoon, 2 * 3600)};
+  TimePickerLogic logic{anchor};
+  const auto props = TimeProps();
+  PickerApplyStats stats;
+  for (auto _ : state) {
+    auto plan = logic.BuildPlan(props, stats);
+    benchmark::DoNotOptimize(plan);
+  }
+}
+BENCHMARK(BM_TimePickerBuildPlan);
+
+void BM_TimePickerApply(benchmark::State &state) {
+  DayAnchor anchor{std::make_shared<FixedOffsetClock>(kNoon, 2 * 3600)};
+  TimePickerLogic logic{anchor};
+  HeadlessTimeControl control;
+  PickerApplyStats stats;
+  const auto plan = logic.BuildPlan(TimeProps(), stats);
+  for (auto _ : state) {
+    logic.Apply(plan, control, stats);
+    benchmark::DoNotOptimize(control.time);
+  }
+}
+BENCHMARK(BM_TimePickerApply);
+
+void BM_TimePickerChangeEvent(benchmark::State &state) {
+  DayAnchor anchor{std::make_shared<FixedOffsetClock>(kNoon, 2 * 3600)};
+  TimePickerLogic logic{anchor};
+  RecordingEventEmitter emitter;
+  emitter.changes.reserve(1 << 20);
+  for (auto _ : state) {
+    logic.OnTimeChanged(9 * 3600 * 1000, emitter);
+    if (emitter.changes.size() == emitter.changes.capacity()) {
+      emitter.changes.clear();
+    }
+  }
+}
+BENCHMARK(BM_TimePickerChangeEvent);
+
+} // namespace
@@ -0,0 +1,204 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HeadlessControls.h"
+#include "PickerLogic.h"
+#include "TestClocks.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+constexpr int64_t kNoon = UtcMilliseconds(2024, 6, 15, 12);
+
+TEST(DatePickerLogic, AppliesDatesInTheTimeZoneOffset) {
+  DatePickerLogic logic;
+  HeadlessDateControl control;
+  MapPropReader props{{
+      {"selectedDate", kNoon},
+      {"minDate", kNoon - 1000 * 3600},
+      {"timeZoneOffsetInSeconds", int64_t{-4 * 3600}},
+  }};
+
+  logic.UpdateProps(props, control);
+
+  ASSERT_TRUE(control.date);
+  EXPECT_EQ(*control.date, kNoon / 1000 - 4 * 3600);
+  ASSERT_TRUE(control.minDate);
+  EXPECT_EQ(*control.minDate, kNoon / 1000 - 5 * 3600);
+  EXPECT_FALSE(control.maxDate);
+  EXPECT_EQ(logic.TimeZoneOffsetInSeconds(), -4 * 3600);
+}
+
+TEST(DatePickerLogic, KeepsTheOffsetAcrossUpdatesWithoutIt) {
+  DatePickerLogic logic;
+  HeadlessDateControl control;
+  logic.UpdateProps(MapPropReader{{{"timeZoneOffsetInSeconds", int64_t{3600}}}}, control);
+  logic.UpdateProps(MapPropReader{{{"selectedDate", kNoon}}}, control);
+
+  ASSERT_TRUE(control.date);
+  EXPECT_EQ(*control.date, kNoon / 1000 + 3600);
+}
+
+TEST(DatePickerLogic, NullPropsClearTheControl) {
+  DatePickerLogic logic;
+  HeadlessDateControl control;
+  logic.UpdateProps(MapPropReader{{{"selectedDate", kNoon}, {"placeholderText", "Pick"}}}, control);
+  ASSERT_TRUE(control.date);
+  ASSERT_TRUE(control.placeholderText);
+
+  logic.UpdateProps(MapPropReader{{{"selectedDate", nullptr}, {"placeholderText", nullptr}}}, control);
+
+  EXPECT_FALSE(control.date);
+  EXPECT_FALSE(control.placeholderText);
+}
+
+TEST(DatePickerLogic, ReportsPickedDatesButNotAppliedOnes) {
+  DatePickerLogic logic;
+  HeadlessDateControl control;
+  RecordingEventEmitter emitter;
+  logic.UpdateProps(MapPropReader{{{"timeZoneOffsetInSeconds", int64_t{7200}}}}, control);
+
+  logic.OnDateChanged(kNoon / 1000 + 7200, emitter);
+
+  ASSERT_EQ(emitter.changes.size(), 1u);
+  EXPECT_EQ(emitter.changes[0], kNoon);
+}
+
+TEST(DatePickerLogic, PlansOffTheControlThread) {
+  DatePickerLogic logic;
+  HeadlessDateControl control;
+  DateApplyPlan plan;
+  std::thread planner{[&] { plan = logic.BuildPlan(MapPropReader{{{"selectedDate", kNoon}}}); }};
+  planner.join();
+
+  EXPECT_EQ(control.setterCalls, 0);
+  logic.Apply(plan, control);
+  ASSERT_TRUE(control.date);
+  EXPECT_EQ(*control.date, kNoon / 1000);
+}
+
+TEST(DatePickerLogic, RejectsWallSecondsThatOverflow) {
+  EXPECT_THROW(MillisecondsFromWallSeconds(std::numeric_limits<int64_t>::max() / 10, 0), std::overflow_error);
+}
+
+TEST(DatePlanBuilder, SeparatesTheChangesFromEveryPropSeen) {
+  DatePlanBuilder builder;
+  builder.SetProp("dateFormat", "{month.full}");
+  builder.SetProp("selectedDate", kNoon);
+  builder.ResetChanges();
+  builder.SetProp("placeholderText", "Pick");
+
+  const auto &changes = builder.Changes();
+  EXPECT_FALSE(changes.dateFormat.changed);
+  EXPECT_FALSE(changes.date.changed);
+  ASSERT_TRUE(changes.placeholderText.value);
+  EXPECT_EQ(*changes.placeholderText.value, PickerTextFromUtf8("Pick"));
+
+  HeadlessDateControl control;
+  ApplyPlan(builder.All(), control);
+  ASSERT_TRUE(control.dateFormat);
+  EXPECT_EQ(*control.dateFormat, PickerTextFromUtf8("{month.full}"));
+  EXPECT_EQ(control.date, kNoon / 1000);
+  EXPECT_EQ(control.placeholderText, PickerTextFromUtf8("Pick"));
+}
+
+TEST(DatePlanBuilder, ReplansDatesWhenTheOffsetChanges) {
+  DatePlanBuilder builder;
+  builder.SetProp("selectedDate", kNoon);
+  builder.SetProp("maxDate", kNoon + 1000 * 3600);
+  builder.ResetChanges();
+  builder.SetProp("timeZoneOffsetInSeconds", int64_t{3600});
+
+  const auto &changes = builder.Changes();
+  EXPECT_EQ(changes.timeZoneOffsetInSeconds, 3600);
+  EXPECT_EQ(changes.date.value, kNoon / 1000 + 3600);
+  EXPECT_EQ(changes.maxDate.value, kNoon / 1000 + 2 * 3600);
+  EXPECT_FALSE(changes.minDate.changed);
+
+  // A removed offset goes back to UTC
+  builder.ResetChanges();
+  builder.SetProp("timeZoneOffsetInSeconds", nullptr);
+  EXPECT_EQ(builder.Changes().date.value, kNoon / 1000);
+  EXPECT_EQ(builder.All().timeZoneOffsetInSeconds, 0);
+}
+
+TEST(DatePlanBuilder, CopiesStartFromThePropsSeen) {
+  DatePlanBuilder first;
+  first.SetProp("timeZoneOffsetInSeconds", int64_t{-3600});
+  first.SetProp("placeholderText", "Pick");
+
+  // As a props object cloned from the previous one
+  DatePlanBuilder second = first;
+  second.ResetChanges();
+  second.SetProp("selectedDate", kNoon);
+
+  EXPECT_EQ(second.Changes().date.value, kNoon / 1000 - 3600);
+  EXPECT_FALSE(second.Changes().placeholderText.changed);
+  EXPECT_TRUE(second.All().placeholderText.changed);
+  EXPECT_FALSE(first.All().date.changed);
+}
+
+TEST(TimePlanBuilder, PlansEachPropAsItIsSet) {
+  DayAnchor anchor{std::make_shared<FixedOffsetClock>(kNoon, 2 * 3600)};
+  TimePlanBuilder builder{anchor};
+  builder.SetProp("is24Hour", true);
+  builder.ResetChanges();
+  builder.SetProp("selectedTime", kNoon);
+  builder.SetProp("minuteInterval", nullptr);
+
+  const auto &changes = builder.Changes();
+  EXPECT_FALSE(changes.is24Hour.changed);
+  EXPECT_EQ(changes.time.value, 14 * 3600 * 1000);
+  EXPECT_TRUE(changes.minuteIncrement.changed);
+  EXPECT_FALSE(changes.minuteIncrement.value);
+  EXPECT_EQ(builder.All().is24Hour.value, true);
+}
+
+TEST(TimePickerLogic, ShowsWholeMinutesOfTheLocalTimeOfDay) {
+  DayAnchor anchor{std::make_shared<FixedOffsetClock>(kNoon, 2 * 3600)};
+  TimePickerLogic logic{anchor};
+  HeadlessTimeControl control;
+
+  logic.UpdateProps(MapPropReader{{{"selectedTime", kNoon + 90 * 1000 + 500}, {"is24Hour", true}}}, control);
+
+  ASSERT_TRUE(control.time);
+  EXPECT_EQ(*control.time, (14 * 60 + 1) * 60 * 1000);
+  ASSERT_TRUE(control.is24Hour);
+  EXPECT_TRUE(*control.is24Hour);
+}
+
+TEST(TimePickerLogic, ReportsPickedTimesOnTheLocalDay) {
+  DayAnchor anchor{std::make_shared<FixedOffsetClock>(kNoon, 2 * 3600)};
+  TimePickerLogic logic{anchor};
+  RecordingEventEmitter emitter;
+
+  logic.OnTimeChanged(9 * 3600 * 1000, emitter);
+
+  ASSERT_EQ(emitter.changes.size(), 1u);
+  EXPECT_EQ(emitter.changes[0], UtcMilliseconds(2024, 6, 15, 7));
+}
+
+TEST(TimePickerLogic, ReportsPickedTimesWithTheOffsetAfterADstTransition) {
+  // Clocks went forward at 02:00 this morning; 09:00 is EDT, not EST
+  DayAnchor anchor{std::make_shared<EasternClock>(EasternMilliseconds(2024, 3, 10, 12))};
+  TimePickerLogic logic{anchor};
+  HeadlessTimeControl control;
+  RecordingEventEmitter emitter;
+
+  logic.OnTimeChanged(9 * 3600 * 1000, emitter);
+  ASSERT_EQ(emitter.changes.size(), 1u);
+  EXPECT_EQ(emitter.changes[0], UtcMilliseconds(2024, 3, 10, 13));
+
+  // The reported value shows the same time when it comes back as selectedTime
+  logic.UpdateProps(MapPropReader{{{"selectedTime", emitter.changes[0]}}}, control);
+  ASSERT_TRUE(control.time);
+  EXPECT_EQ(*control.time, 9 * 3600 * 1000);
+}
+
+} // namespace
@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "HeadlessControls.h"
+#include "InstancePool.h"
+#include "PickerApplyPlan.h"
+#include "PickerSessionBroker.h"
+#include "TestDispatchers.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+// Sessions open at once, as many windows each showing a picker
+constexpr int64_t kSessions = 100;
+
+constexpr int64_t kPickedMilliseconds = 1718452800000;
+
+// Stands in for DatePickerComponent: the plan goes to a headless control, and a pick reports
+// through the callback given to Open
+struct HeadlessDateComponent {
+  std::optional<HeadlessDateControl> control{std::in_place};
+  std::function<void(int64_t)> onSelected;
+
+  void Open(const DateApplyPlan &plan, std::function<void(int64_t)> callback) {
+    ApplyPlan(plan, *control);
+    onSelected = std::move(callback);
+  }
+
+  void Reset() {
+    control.emplace();
+    onSelected = nullptr;
+  }
+};
+
+// Shaped like PickerSessionHost, over a dispatcher with a thread of its own
+struct SessionHost {
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+  PickerSessionBroker<int64_t> sessions{dispatcher, stats};
+  InstancePoolMetrics metrics;
+
+  // UI thread only
+  InstancePool<std::unique_ptr<HeadlessDateComponent>> components{
+      static_cast<size_t>(kSessions),
+      []() { return std::make_unique<HeadlessDateComponent>(); },
+      [](std::unique_ptr<HeadlessDateComponent> &component) {
+        component->Reset();
+        return true;
+      },
+      metrics};
+  std::vector<HeadlessDateComponent *> shownComponents;
+
+  std::atomic<int64_t> shown{0};
+  std::atomic<int64_t> settled{0};
+
+  SessionHost() {
+    sessions.MaxSessions(kSessions);
+  }
+};
+
+// The module's open coroutine, with the headless component in place of the dialog
+PickerTask RunSession(SessionHost &host, PickerSessionId id, DateApplyPlan plan) {
+  const auto session = host.sessions.Begin(id);
+
+  co_await ResumeOn(host.dispatcher);
+
+  std::unique_ptr<HeadlessDateComponent> component;
+  if (!session->IsResolved()) {
+    component = host.components.Acquire();
+    component->Open(plan, [session](int64_t timestamp) { session->Resolve(PickerSessionOutcome::Selected, timestamp); });
+    session->MarkOpen();
+    host.shownComponents.push_back(component.get());
+    host.shown.fetch_add(1, std::memory_order_release);
+  }
+
+  const auto result = co_await *session;
+  host.sessions.End(session);
+  if (component) {
+    host.components.Release(std::move(component));
+  }
+  session->Close();
+
+  benchmark::DoNotOptimize(result.value);
+  host.settled.fetch_add(1, std::memory_order_release);
+}
+
+void WaitFor(const std::atomic<int64_t> &counter, int64_t target) {
+  while (counter.load(std::memory_order_acquire) < target) {
+    std::this_thread::yield();
+  }
+}
+
+// Opens 100 sessions from the JS thread and waits for every picker to be shown. Then the
+// user picks in half of them on the UI thread while JS dismisses the other half.
+void BM_OpenAndSettleConcurrentSessions(benchmark::State &state) {
+  SessionHost host;
+  DateApplyPlan plan;
+  plan.date.Set(kPickedMilliseconds / 1000);
+
+  for (auto _ : state) {
+    host.shown.store(0, std::memory_order_relaxed);
+    host.settled.store(0, std::memory_order_relaxed);
+
+    for (PickerSessionId id = 0; id < kSessions; ++id) {
+      RunSession(host, id, plan);
+    }
+    WaitFor(host.shown, kSessions);
+
+    // Components of even ids are shown at even positions, as the sessions resume in order
+    host.dispatcher.Post([&host]() {
+      for (size_t i = 0; i < host.shownComponents.size(); i += 2) {
+        host.shownComponents[i]->onSelected(kPickedMilliseconds);
+      }
+      host.shownComponents.clear();
+    });
+    for (PickerSessionId id = 1; id < kSessions; id += 2) {
+      host.sessions.Dismiss(id);
+    }
+    WaitFor(host.settled, kSessions);
+  }
+
+  state.SetItemsProcessed(state.iterations() * kSessions);
+  state.counters["componentsCreated"] = static_cast<double>(host.metrics.misses.load());
+  state.counters["maxActive"] = static_cast<double>(host.stats.maxActive.load());
+}
+BENCHMARK(BM_OpenAndSettleConcurrentSessions)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,326 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "PickerSessionBroker.h"
+#include "TestDispatchers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+using Session = PickerSession<int64_t>;
+
+// What an awaiting coroutine saw when it continued
+struct AwaitRecord {
+  std::atomic<int> resumed{0};
+  std::atomic<bool> done{false};
+  PickerSessionOutcome outcome{};
+  std::optional<int64_t> value;
+  std::thread::id thread;
+};
+
+PickerTask AwaitSession(std::shared_ptr<Session> session, AwaitRecord &record) {
+  const auto result = co_await *session;
+  record.outcome = result.outcome;
+  record.value = result.value;
+  record.thread = std::this_thread::get_id();
+  record.resumed.fetch_add(1, std::memory_order_relaxed);
+  record.done.store(true, std::memory_order_release);
+}
+
+void WaitFor(const std::atomic<bool> &flag) {
+  while (!flag.load(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+}
+
+TEST(PickerSession, SettlesOnceAndResumesTheAwaiterOnTheDispatcher) {
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+  auto session = std::make_shared<Session>(1, dispatcher, stats);
+  EXPECT_EQ(session->State(), PickerSessionState::Opening);
+
+  AwaitRecord record;
+  AwaitSession(session, record);
+  EXPECT_FALSE(record.done.load());
+
+  EXPECT_TRUE(session->MarkOpen());
+  EXPECT_EQ(session->State(), PickerSessionState::Open);
+  EXPECT_TRUE(session->Resolve(PickerSessionOutcome::Selected, 42));
+  EXPECT_FALSE(session->Resolve(PickerSessionOutcome::Dismissed));
+  EXPECT_EQ(session->State(), PickerSessionState::Resolving);
+
+  WaitFor(record.done);
+  EXPECT_EQ(record.outcome, PickerSessionOutcome::Selected);
+  EXPECT_EQ(record.value, 42);
+  EXPECT_EQ(record.thread, dispatcher.UIThreadId());
+
+  session->Close();
+  EXPECT_EQ(session->State(), PickerSessionState::Idle);
+  EXPECT_FALSE(session->Resolve(PickerSessionOutcome::TimedOut));
+  EXPECT_EQ(stats.selected.load(), 1);
+  EXPECT_EQ(stats.shown.load(), 1);
+}
+
+TEST(PickerSession, AwaitingASettledSessionContinuesInline) {
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+  auto session = std::make_shared<Session>(1, dispatcher, stats);
+  EXPECT_TRUE(session->Resolve(PickerSessionOutcome::Cancelled));
+  EXPECT_FALSE(session->MarkOpen());
+  EXPECT_EQ(stats.shown.load(), 0);
+
+  AwaitRecord record;
+  AwaitSession(session, record);
+  EXPECT_TRUE(record.done.load());
+  EXPECT_EQ(record.outcome, PickerSessionOutcome::Cancelled);
+  EXPECT_FALSE(record.value);
+  EXPECT_EQ(record.thread, std::this_thread::get_id());
+}
+
+// The UI thread opens and selects, the JS thread dismisses, a timer times out and a newer open
+// cancels, all at once, while the coroutine starts awaiting. Exactly one of them wins, and the
+// coroutine continues exactly once with what it set.
+TEST(PickerSession, ConcurrentSettlersAgreeOnOneOutcome) {
+  constexpr int kRounds = 2000;
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+
+  std::shared_ptr<Session> session;
+  std::array<std::atomic<bool>, 4> won{};
+  std::atomic<bool> markedOpen{false};
+  std::barrier sync{5};
+
+  const auto settler = [&](size_t index, auto settle) {
+    return std::thread{[&, index, settle] {
+      for (int round = 0; round < kRounds; ++round) {
+        sync.arrive_and_wait();
+        won[index].store(settle(*session, round), std::memory_order_relaxed);
+        sync.arrive_and_wait();
+      }
+    }};
+  };
+  std::vector<std::thread> threads;
+  threads.push_back(settler(0, [&](Session &current, int round) {
+    markedOpen.store(current.MarkOpen(), std::memory_order_relaxed);
+    return current.Resolve(PickerSessionOutcome::Selected, int64_t{round});
+  }));
+  threads.push_back(settler(1, [](Session &current, int) { return current.Resolve(PickerSessionOutcome::Dismissed); }));
+  threads.push_back(settler(2, [](Session &current, int) { return current.Resolve(PickerSessionOutcome::TimedOut); }));
+  threads.push_back(settler(3, [](Session &current, int) { return current.Resolve(PickerSessionOutcome::Cancelled); }));
+
+  for (int round = 0; round < kRounds; ++round) {
+    session = std::make_shared<Session>(round, dispatcher, stats);
+    AwaitRecord record;
+    sync.arrive_and_wait();
+    AwaitSession(session, record);
+    sync.arrive_and_wait();
+    WaitFor(record.done);
+
+    int winners = 0;
+    for (size_t index = 0; index < won.size(); ++index) {
+      if (won[index].load(std::memory_order_relaxed)) {
+        ++winners;
+        EXPECT_EQ(record.outcome, static_cast<PickerSessionOutcome>(index)) << "round " << round;
+      }
+    }
+    ASSERT_EQ(winners, 1) << "round " << round;
+    EXPECT_EQ(record.value.has_value(), record.outcome == PickerSessionOutcome::Selected);
+    if (record.value) {
+      EXPECT_EQ(*record.value, round);
+    }
+    // Opening only fails when another settler got there first
+    if (!markedOpen.load(std::memory_order_relaxed)) {
+      EXPECT_NE(record.outcome, PickerSessionOutcome::Selected);
+    }
+    EXPECT_EQ(session->State(), PickerSessionState::Resolving);
+    session->Close();
+    EXPECT_EQ(session->State(), PickerSessionState::Idle);
+    EXPECT_EQ(record.resumed.load(), 1);
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(stats.selected + stats.dismissed + stats.timedOut + stats.cancelled, kRounds);
+}
+
+using Broker = PickerSessionBroker<int64_t>;
+
+TEST(PickerSessionBroker, ReplacesSessionsWithTheSameIdAndEvictsTheOldest) {
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+  Broker broker{dispatcher, stats};
+  broker.MaxSessions(3);
+
+  auto first = broker.Begin(1);
+  auto second = broker.Begin(2);
+  auto third = broker.Begin(3);
+  auto secondAgain = broker.Begin(2);
+  EXPECT_TRUE(second->IsResolved());
+  EXPECT_EQ(broker.ActiveSessions(), 3u);
+
+  // The replacement counts as a new open, so the oldest is now the first session, not the third
+  auto fourth = broker.Begin(4);
+  EXPECT_TRUE(first->IsResolved());
+  EXPECT_FALSE(third->IsResolved());
+  EXPECT_FALSE(secondAgain->IsResolved());
+  EXPECT_EQ(broker.State(1), PickerSessionState::Idle);
+  EXPECT_EQ(broker.State(4), PickerSessionState::Opening);
+  EXPECT_EQ(stats.cancelled.load(), 2);
+
+  EXPECT_TRUE(broker.Dismiss(3));
+  EXPECT_FALSE(broker.Dismiss(3));
+  EXPECT_EQ(broker.DismissAll(), 2u);
+  EXPECT_EQ(broker.ActiveSessions(), 0u);
+  EXPECT_EQ(stats.dismissed.load(), 3);
+  EXPECT_EQ(stats.active.load(), 0);
+  EXPECT_EQ(stats.maxActive.load(), 3);
+}
+
+TEST(PickerSessionBroker, EndOnlyDropsTheSessionItWasGiven) {
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+  Broker broker{dispatcher, stats};
+
+  auto replaced = broker.Begin(1);
+  auto current = broker.Begin(1);
+  broker.End(replaced);
+  EXPECT_EQ(broker.ActiveSessions(), 1u);
+
+  current->Resolve(PickerSessionOutcome::Selected, 5);
+  broker.End(current);
+  EXPECT_EQ(broker.ActiveSessions(), 0u);
+  EXPECT_EQ(stats.active.load(), 0);
+}
+
+// Opens from several threads at once with distinct ids. The broker never holds more than its
+// cap, and always evicts the globally oldest session, so what stays pending of each thread's
+// opens is its latest ones.
+TEST(PickerSessionBroker, EvictsTheOldestSessionsUnderContention) {
+  constexpr size_t kCap = 4;
+  constexpr int kThreads = 4;
+  constexpr int kOpensPerThread = 500;
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+  Broker broker{dispatcher, stats};
+  broker.MaxSessions(kCap);
+
+  std::atomic<bool> done{false};
+  std::atomic<size_t> mostSeen{0};
+  std::thread observer{[&] {
+    while (!done.load(std::memory_order_relaxed)) {
+      const size_t active = broker.ActiveSessions();
+      if (active > mostSeen.load(std::memory_order_relaxed)) {
+        mostSeen.store(active, std::memory_order_relaxed);
+      }
+    }
+  }};
+
+  std::vector<std::vector<std::shared_ptr<Broker::Session>>> opened(kThreads);
+  std::vector<std::thread> openers;
+  for (int thread = 0; thread < kThreads; ++thread) {
+    openers.emplace_back([&, thread] {
+      for (int open = 0; open < kOpensPerThread; ++open) {
+        opened[thread].push_back(broker.Begin(thread * kOpensPerThread + open));
+      }
+    });
+  }
+  for (auto &opener : openers) {
+    opener.join();
+  }
+  done.store(true, std::memory_order_relaxed);
+  observer.join();
+
+  EXPECT_LE(mostSeen.load(), kCap);
+  EXPECT_EQ(broker.ActiveSessions(), kCap);
+  EXPECT_EQ(stats.active.load(), static_cast<int64_t>(kCap));
+  EXPECT_LE(stats.maxActive.load(), static_cast<int64_t>(kCap));
+  EXPECT_EQ(stats.cancelled.load(), kThreads * kOpensPerThread - static_cast<int64_t>(kCap));
+
+  size_t pending = 0;
+  for (const auto &sessions : opened) {
+    const auto firstPending =
+        std::find_if(sessions.begin(), sessions.end(), [](const auto &session) { return !session->IsResolved(); });
+    for (auto session = firstPending; session != sessions.end(); ++session) {
+      EXPECT_FALSE((*session)->IsResolved()) << "session " << (*session)->Id() << " was evicted before an older one";
+      ++pending;
+    }
+  }
+  EXPECT_EQ(pending, kCap);
+}
+
+// Opens with reused ids and short timeouts, dismissals and awaiting coroutines that end their
+// session when it settles, all at once. Every session settles exactly once and the broker
+// ends up empty.
+TEST(PickerSessionBroker, EverySessionSettlesOnceUnderContention) {
+  constexpr int kThreads = 3;
+  constexpr int kOpensPerThread = 400;
+  ThreadDispatcher dispatcher;
+  PickerSessionStats stats;
+  Broker broker{dispatcher, stats};
+  broker.MaxSessions(4);
+
+  std::vector<std::unique_ptr<AwaitRecord>> records(kThreads * kOpensPerThread);
+  for (auto &record : records) {
+    record = std::make_unique<AwaitRecord>();
+  }
+  const auto awaitAndEnd = [&broker](std::shared_ptr<Broker::Session> session, AwaitRecord &record) -> PickerTask {
+    const auto result = co_await *session;
+    broker.End(session);
+    session->Close();
+    record.outcome = result.outcome;
+    record.resumed.fetch_add(1, std::memory_order_relaxed);
+    record.done.store(true, std::memory_order_release);
+  };
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back([&, thread] {
+      std::mt19937 random{static_cast<uint32_t>(thread)};
+      for (int open = 0; open < kOpensPerThread; ++open) {
+        const PickerSessionId id = random() % 8;
+        std::optional<std::chrono::milliseconds> timeout;
+        if (random() % 2 == 0) {
+          timeout = std::chrono::milliseconds{random() % 3};
+        }
+        auto session = broker.Begin(id, timeout);
+        awaitAndEnd(session, *records[thread * kOpensPerThread + open]);
+        if (random() % 4 == 0) {
+          broker.Dismiss(random() % 8);
+        }
+        if (random() % 3 == 0) {
+          session->MarkOpen();
+          session->Resolve(PickerSessionOutcome::Selected, open);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  broker.DismissAll();
+
+  for (const auto &record : records) {
+    WaitFor(record->done);
+    EXPECT_EQ(record->resumed.load(), 1);
+  }
+  EXPECT_EQ(broker.ActiveSessions(), 0u);
+  EXPECT_EQ(stats.active.load(), 0);
+  EXPECT_EQ(stats.opened.load(), kThreads * kOpensPerThread);
+  EXPECT_EQ(stats.selected + stats.dismissed + stats.timedOut + stats.cancelled, kThreads * kOpensPerThread);
+}
+
+} // namespace
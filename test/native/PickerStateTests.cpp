@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "RNDateTimePickerState.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace facebook::react;
+
+namespace {
+
+// Stands in for ConcreteState: holds the data and records the updates committed through it
+class FakeState {
+public:
+  explicit FakeState(Size frameSize) : m_data(frameSize) {}
+
+  const RNDateTimePickerState &getData() const {
+    return m_data;
+  }
+
+  void updateState(RNDateTimePickerState &&data) const {
+    m_updates.push_back(data.frameSize);
+  }
+
+  const std::vector<Size> &Updates() const {
+    return m_updates;
+  }
+
+private:
+  RNDateTimePickerState m_data;
+  mutable std::vector<Size> m_updates;
+};
+
+TEST(PickerState, SizesWithinTheToleranceAreEqual) {
+  const RNDateTimePickerState state{Size{320, 216}};
+  EXPECT_TRUE(state.hasFrameSize(Size{320, 216}));
+  EXPECT_TRUE(state.hasFrameSize(Size{320.5, 215.5}));
+  EXPECT_TRUE(state.hasFrameSize(Size{319.75, 216.25}));
+  EXPECT_FALSE(state.hasFrameSize(Size{320.6, 216}));
+  EXPECT_FALSE(state.hasFrameSize(Size{320, 215.4}));
+
+  EXPECT_FALSE(state.hasFrameSize(Size{320.25, 216}, 0));
+  EXPECT_TRUE(state.hasFrameSize(Size{322, 214}, 2));
+}
+
+TEST(PickerState, UnchangedSizesAreNotCommitted) {
+  FakeState state{Size{320, 216}};
+  const size_t commits = RNDateTimePickerState::commitCount();
+
+  EXPECT_FALSE(updateFrameSize(state, Size{320, 216}));
+  EXPECT_FALSE(updateFrameSize(state, Size{320.3, 216.1}));
+  EXPECT_TRUE(state.Updates().empty());
+  EXPECT_EQ(RNDateTimePickerState::commitCount(), commits);
+}
+
+TEST(PickerState, ChangedSizesAreCommittedAndCounted) {
+  FakeState state{Size{320, 216}};
+  const size_t commits = RNDateTimePickerState::commitCount();
+
+  EXPECT_TRUE(updateFrameSize(state, Size{320, 300}));
+  ASSERT_EQ(state.Updates().size(), 1u);
+  EXPECT_EQ(state.Updates()[0], (Size{320, 300}));
+  EXPECT_EQ(RNDateTimePickerState::commitCount(), commits + 1);
+}
+
+} // namespace
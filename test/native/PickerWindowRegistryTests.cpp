@@ -0,0 +1,239 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "LivePickerViews.h"
+#include "PickerWindowRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <barrier>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+
+namespace {
+
+struct FakeWindow {
+  explicit FakeWindow(PickerWindowId windowId) : id(windowId) {}
+  PickerWindowId id;
+};
+
+using Registry = PickerWindowRegistry<FakeWindow>;
+
+struct RegistryFixture {
+  std::shared_ptr<FakeWindow> Get(PickerWindowId id) {
+    return registry.Get(id, [id]() { return std::make_shared<FakeWindow>(id); });
+  }
+
+  PickerWindowRegistryStats stats;
+  Registry registry{stats};
+};
+
+TEST(PickerWindowRegistry, HandsOutUniqueIds) {
+  RegistryFixture fixture;
+  const auto first = fixture.registry.NewWindowId();
+  const auto second = fixture.registry.NewWindowId();
+  EXPECT_GT(first, 0);
+  EXPECT_GT(second, first);
+}
+
+TEST(PickerWindowRegistry, CreatesEachWindowOnceAndServesRepeatsFromTheThreadCache) {
+  RegistryFixture fixture;
+  auto window = fixture.Get(1);
+  ASSERT_NE(window, nullptr);
+  EXPECT_EQ(window->id, 1);
+  EXPECT_EQ(fixture.stats.created.load(), 1);
+
+  EXPECT_EQ(fixture.Get(1), window);
+  EXPECT_EQ(fixture.stats.threadHits.load(), 1);
+  EXPECT_EQ(fixture.registry.Find(1), window);
+  EXPECT_EQ(fixture.registry.Find(2), nullptr);
+
+  // Another window takes over the thread cache; the first is then found in the directory
+  auto other = fixture.Get(2);
+  EXPECT_NE(other, window);
+  EXPECT_EQ(fixture.Get(1), window);
+  EXPECT_EQ(fixture.stats.created.load(), 2);
+  EXPECT_EQ(fixture.stats.sharedLookups.load(), 1);
+}
+
+TEST(PickerWindowRegistry, ForgetsWindowsOnceTheirLastOwnerIsGone) {
+  RegistryFixture fixture;
+  auto window = fixture.Get(1);
+  auto other = fixture.Get(2);
+  EXPECT_EQ(fixture.registry.LiveWindows(), 2u);
+
+  window.reset();
+  EXPECT_EQ(fixture.registry.Find(1), nullptr);
+  EXPECT_EQ(fixture.registry.LiveWindows(), 1u);
+  ASSERT_EQ(fixture.registry.Live().size(), 1u);
+  EXPECT_EQ(fixture.registry.Live()[0], other);
+
+  // Asking again creates a new window, even on the thread that cached the old one
+  other.reset();
+  auto recreated = fixture.Get(2);
+  EXPECT_EQ(recreated->id, 2);
+  EXPECT_EQ(fixture.stats.created.load(), 3);
+  EXPECT_EQ(fixture.registry.LiveWindows(), 1u);
+}
+
+TEST(PickerWindowRegistry, ListsLiveWindowsInIdOrder) {
+  RegistryFixture fixture;
+  std::vector<std::shared_ptr<FakeWindow>> windows;
+  for (PickerWindowId id : {5, 2, 9, 1}) {
+    windows.push_back(fixture.Get(id));
+  }
+  windows.erase(windows.begin() + 2);
+
+  std::vector<PickerWindowId> ids;
+  for (const auto &window : fixture.registry.Live()) {
+    ids.push_back(window->id);
+  }
+  EXPECT_EQ(ids, (std::vector<PickerWindowId>{1, 2, 5}));
+}
+
+TEST(PickerWindowRegistry, RegistriesDoNotShareTheThreadCache) {
+  RegistryFixture first;
+  RegistryFixture second;
+  auto window = first.Get(1);
+  auto otherWindow = second.Get(1);
+  EXPECT_NE(window, otherWindow);
+  EXPECT_EQ(first.Get(1), window);
+  EXPECT_EQ(second.Get(1), otherWindow);
+}
+
+TEST(PickerWindowRegistry, ConcurrentLookupsCreateOneWindowPerId) {
+  constexpr int kThreads = 8;
+  constexpr int kRounds = 200;
+  RegistryFixture fixture;
+  std::barrier sync{kThreads};
+  std::vector<std::vector<std::shared_ptr<FakeWindow>>> seen(kThreads);
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back([&, thread] {
+      for (int round = 0; round < kRounds; ++round) {
+        sync.arrive_and_wait();
+        // Everyone asks for the round's window; half the threads also look at the previous one
+        seen[thread].push_back(fixture.Get(round + 1));
+        if (thread % 2 == 0 && round > 0) {
+          EXPECT_NE(fixture.registry.Find(round), nullptr);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(fixture.stats.created.load(), kRounds);
+  for (int round = 0; round < kRounds; ++round) {
+    for (int thread = 1; thread < kThreads; ++thread) {
+      ASSERT_EQ(seen[thread][round], seen[0][round]) << "round " << round;
+    }
+  }
+  EXPECT_EQ(fixture.registry.LiveWindows(), static_cast<size_t>(kRounds));
+}
+
+// Runs posted work only when the test says so, like a UI thread that is busy until then
+class ManualDispatcher {
+public:
+  void Post(std::function<void()> callback) {
+    if (refusePosts) {
+      throw std::runtime_error{"dispatcher shut down"};
+    }
+    m_posted.push_back(std::move(callback));
+  }
+
+  size_t Pending() const noexcept {
+    return m_posted.size();
+  }
+
+  void RunAll() {
+    auto posted = std::move(m_posted);
+    m_posted.clear();
+    for (auto &callback : posted) {
+      callback();
+    }
+  }
+
+  bool refusePosts{false};
+
+private:
+  std::vector<std::function<void()>> m_posted;
+};
+
+// Shaped like PickerWindow: a dispatcher of its own and the views mounted in it
+struct BroadcastWindow {
+  explicit BroadcastWindow(PickerWindowId windowId) : id(windowId) {}
+
+  PickerWindowId id;
+  ManualDispatcher dispatcher;
+  LivePickerViews views;
+};
+
+TEST(PickerWindowRegistry, BroadcastReachesEveryLiveWindowOnItsOwnDispatcher) {
+  PickerWindowRegistryStats stats;
+  PickerWindowRegistry<BroadcastWindow> registry{stats};
+  const auto get = [&registry](PickerWindowId id) {
+    return registry.Get(id, [id]() { return std::make_shared<BroadcastWindow>(id); });
+  };
+
+  // Four windows with two views each; the refresh records which window ran it
+  std::vector<std::shared_ptr<BroadcastWindow>> windows;
+  std::vector<PickerWindowId> refreshedIn;
+  const BroadcastWindow *running = nullptr;
+  for (PickerWindowId id = 1; id <= 4; ++id) {
+    windows.push_back(get(id));
+    for (int view = 0; view < 2; ++view) {
+      windows.back()->views.Add([&refreshedIn, &running, window = windows.back().get()]() {
+        EXPECT_EQ(running, window) << "refreshed on another window's dispatcher";
+        refreshedIn.push_back(window->id);
+        return true;
+      });
+    }
+  }
+
+  // Window 4 is already gone, and window 3's dispatcher is shutting down
+  std::weak_ptr<BroadcastWindow> gone = windows[3];
+  windows.pop_back();
+  EXPECT_TRUE(gone.expired());
+  windows[2]->dispatcher.refusePosts = true;
+
+  const auto refreshAll = [](BroadcastWindow &window) { window.views.RefreshAll(); };
+  EXPECT_EQ(registry.PostToLiveWindows(refreshAll), 2u);
+  EXPECT_TRUE(refreshedIn.empty());
+
+  for (const auto &window : windows) {
+    running = window.get();
+    window->dispatcher.RunAll();
+  }
+  EXPECT_EQ(refreshedIn, (std::vector<PickerWindowId>{1, 1, 2, 2}));
+}
+
+TEST(PickerWindowRegistry, BroadcastSkipsWindowsTornDownBeforeTheirTurn) {
+  PickerWindowRegistryStats stats;
+  PickerWindowRegistry<BroadcastWindow> registry{stats};
+  auto window = registry.Get(1, []() { return std::make_shared<BroadcastWindow>(1); });
+  int refreshed = 0;
+  window->views.Add([&refreshed]() {
+    ++refreshed;
+    return true;
+  });
+
+  EXPECT_EQ(registry.PostToLiveWindows([](BroadcastWindow &live) { live.views.RefreshAll(); }), 1u);
+  ASSERT_EQ(window->dispatcher.Pending(), 1u);
+
+  // The UI thread outlives the window, as it does when an instance is reloaded
+  auto uiThread = std::move(window->dispatcher);
+  window.reset();
+  uiThread.RunAll();
+  EXPECT_EQ(refreshed, 0);
+}
+
+} // namespace
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "SharedCache.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace winrt::DateTimePicker::Helpers;
+
+namespace {
+
+// Shaped like the formatter table: a few dozen entries looked up by key on every format
+using Table = std::unordered_map<std::string, int64_t>;
+
+Table MakeTable() {
+  Table table;
+  for (int i = 0; i < 32; ++i) {
+    table.emplace("template" + std::to_string(i), i);
+  }
+  return table;
+}
+
+const std::string kKey = "template17";
+
+// Up to the thread counts of large machines, where reader contention shows
+constexpr int kMaxThreads = 64;
+
+void BM_SharedCacheRead(benchmark::State &state) {
+  static SharedCache<Table> cache{MakeTable()};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache.Read([](const Table &table) { return table.find(kKey)->second; }));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedCacheRead)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+// The read path SharedCache replaces: a mutex around a shared_ptr copy
+void BM_MutexSharedPtrRead(benchmark::State &state) {
+  static std::mutex mutex;
+  static std::shared_ptr<const Table> table = std::make_shared<const Table>(MakeTable());
+  for (auto _ : state) {
+    std::shared_ptr<const Table> current;
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      current = table;
+    }
+    benchmark::DoNotOptimize(current->find(kKey)->second);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexSharedPtrRead)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+void BM_AtomicSharedPtrRead(benchmark::State &state) {
+  static std::shared_ptr<const Table> table = std::make_shared<const Table>(MakeTable());
+  for (auto _ : state) {
+    const auto current = std::atomic_load(&table);
+    benchmark::DoNotOptimize(current->find(kKey)->second);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AtomicSharedPtrRead)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+// Readers share a lock on the table itself; every read still writes the lock's cache line
+void BM_SharedMutexRead(benchmark::State &state) {
+  static std::shared_mutex mutex;
+  static const Table table = MakeTable();
+  for (auto _ : state) {
+    std::shared_lock<std::shared_mutex> lock{mutex};
+    benchmark::DoNotOptimize(table.find(kKey)->second);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedMutexRead)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+// Thread 0 keeps publishing new tables while the others read. With one thread this is the
+// update cost alone.
+void BM_SharedCacheReadDuringUpdates(benchmark::State &state) {
+  static SharedCache<Table> cache{MakeTable()};
+  int64_t updates = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      cache.Update([&](Table &table) { table[kKey] = ++updates; });
+    } else {
+      benchmark::DoNotOptimize(cache.Read([](const Table &table) { return table.find(kKey)->second; }));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedCacheReadDuringUpdates)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+// The same against a shared_mutex, where the writer holds the readers off while it updates
+void BM_SharedMutexReadDuringUpdates(benchmark::State &state) {
+  static std::shared_mutex mutex;
+  static Table table = MakeTable();
+  int64_t updates = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      std::unique_lock<std::shared_mutex> lock{mutex};
+      table[kKey] = ++updates;
+    } else {
+      std::shared_lock<std::shared_mutex> lock{mutex};
+      benchmark::DoNotOptimize(table.find(kKey)->second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedMutexReadDuringUpdates)->ThreadRange(1, kMaxThreads)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "SharedCache.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+
+namespace {
+
+// Counts the live copies, so tests can see when retired values are freed
+struct Tracked {
+  static inline std::atomic<int> live{0};
+
+  explicit Tracked(int initial = 0) : value(initial) {
+    live.fetch_add(1, std::memory_order_relaxed);
+  }
+  Tracked(const Tracked &other) : value(other.value) {
+    live.fetch_add(1, std::memory_order_relaxed);
+  }
+  ~Tracked() {
+    live.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  int value;
+};
+
+TEST(SharedCache, ReadsTheLatestPublishedValue) {
+  SharedCache<std::vector<int>> cache{{1, 2}};
+  EXPECT_EQ(cache.Read()->size(), 2u);
+
+  cache.Update([](std::vector<int> &values) { values.push_back(3); });
+  EXPECT_EQ(*cache.Read(), (std::vector<int>{1, 2, 3}));
+
+  EXPECT_EQ(cache.Update([](std::vector<int> &values) { return values.size(); }), 3u);
+  cache.Publish({7});
+  EXPECT_EQ(cache.Read([](const std::vector<int> &values) { return values.front(); }), 7);
+}
+
+TEST(SharedCache, UpdatersReturningFalseLeaveTheValueAlone) {
+  SharedCache<Tracked> cache{Tracked{1}};
+  const Tracked *before = &*cache.Read();
+  EXPECT_FALSE(cache.Update([](Tracked &value) {
+    value.value = 2;
+    return false;
+  }));
+  EXPECT_EQ(&*cache.Read(), before);
+  EXPECT_EQ(cache.Read()->value, 1);
+}
+
+TEST(SharedCache, RetiredValuesOutliveTheReadersThatCanSeeThem) {
+  EpochDomain::Shared().Reclaim();
+  const int liveBefore = Tracked::live.load();
+  {
+    SharedCache<Tracked> cache{Tracked{1}};
+    {
+      const auto read = cache.Read();
+      cache.Publish(Tracked{2});
+      cache.Publish(Tracked{3});
+      // Both retired values are held back by this read, which still sees the first one
+      EXPECT_EQ(read->value, 1);
+      EXPECT_EQ(Tracked::live.load(), liveBefore + 3);
+    }
+
+    EpochDomain::Shared().Reclaim();
+    EXPECT_EQ(Tracked::live.load(), liveBefore + 1);
+    EXPECT_EQ(cache.Read()->value, 3);
+
+    // Without readers, a publish frees the value it replaces right away
+    cache.Publish(Tracked{4});
+    EXPECT_EQ(Tracked::live.load(), liveBefore + 1);
+  }
+  EXPECT_EQ(Tracked::live.load(), liveBefore);
+}
+
+TEST(SharedCache, NestedReadsShareOneAnnouncement) {
+  SharedCache<Tracked> cache{Tracked{1}};
+  const auto outer = cache.Read();
+  {
+    const auto inner = cache.Read();
+    cache.Publish(Tracked{2});
+    EXPECT_EQ(inner->value, 1);
+  }
+  // The outer read still holds the first value back
+  EpochDomain::Shared().Reclaim();
+  EXPECT_EQ(outer->value, 1);
+  EXPECT_EQ(cache.Read()->value, 2);
+}
+
+TEST(SharedCache, ReadersSeeConsistentValuesWhileWritersPublish) {
+  struct Pair {
+    int64_t first{0};
+    int64_t second{0};
+  };
+  SharedCache<Pair> cache;
+  constexpr int64_t kUpdates = 20000;
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> readers;
+  for (int reader = 0; reader < 3; ++reader) {
+    readers.emplace_back([&] {
+      int64_t last = 0;
+      while (!done.load(std::memory_order_acquire)) {
+        const auto value = cache.Read();
+        ASSERT_EQ(value->first, value->second);
+        ASSERT_GE(value->first, last);
+        last = value->first;
+      }
+    });
+  }
+
+  std::vector<std::thread> writers;
+  for (int writer = 0; writer < 2; ++writer) {
+    writers.emplace_back([&] {
+      for (int64_t update = 0; update < kUpdates / 2; ++update) {
+        cache.Update([](Pair &value) {
+          ++value.first;
+          ++value.second;
+        });
+      }
+    });
+  }
+  for (auto &writer : writers) {
+    writer.join();
+  }
+  done.store(true, std::memory_order_release);
+  for (auto &reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(cache.Read()->first, kUpdates);
+  EpochDomain::Shared().Reclaim();
+}
+
+} // namespace
@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Fake clocks for DayAnchor and the date math, so tests can stand at any instant in any time zone.
+
+#include "DayAnchor.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace winrt::DateTimePicker::Helpers::Testing {
+
+/// <summary>
+/// Clock in a time zone without DST. The current time can be moved by tests.
+/// </summary>
+class FixedOffsetClock final : public IDayAnchorClock {
+public:
+  FixedOffsetClock(int64_t nowMilliseconds, int64_t offsetSeconds) noexcept
+      : m_now(nowMilliseconds), m_offsetSeconds(offsetSeconds) {}
+
+  int64_t NowMilliseconds() const noexcept override {
+    return m_now.load(std::memory_order_relaxed);
+  }
+
+  int64_t UtcOffsetSecondsAt(int64_t) const noexcept override {
+    return m_offsetSeconds;
+  }
+
+  void SetNow(int64_t nowMilliseconds) noexcept {
+    m_now.store(nowMilliseconds, std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<int64_t> m_now;
+  const int64_t m_offsetSeconds;
+};
+
+/// <summary>
+/// UTC milliseconds of a UTC calendar date and time.
+/// </summary>
+constexpr int64_t UtcMilliseconds(int64_t year, int32_t month, int32_t day, int32_t hour = 0, int32_t minute = 0) noexcept {
+  return ((DaysFromCivil(year, month, day) * 24 + hour) * 60 + minute) * 60 * 1000;
+}
+
+/// <summary>
+/// Clock in US Eastern time with the rules in force since 2007: EDT (UTC-4) from 2:00 EST on
+/// the second Sunday of March to 2:00 EDT on the first Sunday of November, EST (UTC-5) otherwise.
+/// </summary>
+class EasternClock final : public IDayAnchorClock {
+public:
+  explicit EasternClock(int64_t nowMilliseconds) noexcept : m_now(nowMilliseconds) {}
+
+  int64_t NowMilliseconds() const noexcept override {
+    return m_now.load(std::memory_order_relaxed);
+  }
+
+  int64_t UtcOffsetSecondsAt(int64_t utcSeconds) const noexcept override {
+    const int64_t year = CivilFromDays(FloorDiv(utcSeconds, kSecondsPerDay)).year;
+    const int64_t start = UtcMilliseconds(year, 3, NthSunday(year, 3, 2), 7) / 1000;
+    const int64_t end = UtcMilliseconds(year, 11, NthSunday(year, 11, 1), 6) / 1000;
+    return utcSeconds >= start && utcSeconds < end ? -4 * 3600 : -5 * 3600;
+  }
+
+  void SetNow(int64_t nowMilliseconds) noexcept {
+    m_now.store(nowMilliseconds, std::memory_order_relaxed);
+  }
+
+private:
+  static int32_t NthSunday(int64_t year, int32_t month, int32_t n) noexcept {
+    const int32_t firstWeekday = WeekdayFromDays(DaysFromCivil(year, month, 1));
+    return 1 + (7 - firstWeekday) % 7 + (n - 1) * 7;
+  }
+
+  std::atomic<int64_t> m_now;
+};
+
+/// <summary>
+/// UTC milliseconds of a US Eastern wall-clock time that is neither skipped nor repeated.
+/// </summary>
+inline int64_t EasternMilliseconds(int64_t year, int32_t month, int32_t day, int32_t hour, int32_t minute = 0) noexcept {
+  const int64_t local = UtcMilliseconds(year, month, day, hour, minute);
+  const EasternClock clock{0};
+  return local - clock.UtcOffsetSecondsAt(local / 1000 + 5 * 3600) * 1000;
+}
+
+} // namespace winrt::DateTimePicker::Helpers::Testing
@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Dispatcher for the session broker that runs its callbacks on threads of its own.
+
+#include "PickerSessionBroker.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace winrt::DateTimePicker::Helpers::Testing {
+
+/// <summary>
+/// Runs posted callbacks in order on its own thread, like a UI dispatcher, and delayed ones on
+/// a timer thread. Both threads finish the callbacks already queued before the dispatcher goes.
+/// </summary>
+class ThreadDispatcher final : public IPickerDispatcher {
+public:
+  ThreadDispatcher() : m_uiThread([this] { Run(m_posted); }), m_timerThread([this] { Run(m_delayed); }) {}
+
+  ~ThreadDispatcher() override {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      m_stopping = true;
+    }
+    m_wake.notify_all();
+    m_uiThread.join();
+    m_timerThread.join();
+  }
+
+  void Post(std::function<void()> callback) override {
+    Enqueue(m_posted, {}, std::move(callback));
+  }
+
+  void PostDelayed(std::chrono::milliseconds delay, std::function<void()> callback) override {
+    Enqueue(m_delayed, std::chrono::steady_clock::now() + delay, std::move(callback));
+  }
+
+  std::thread::id UIThreadId() const noexcept {
+    return m_uiThread.get_id();
+  }
+
+private:
+  using Queue = std::multimap<std::chrono::steady_clock::time_point, std::function<void()>>;
+
+  void Enqueue(Queue &queue, std::chrono::steady_clock::time_point due, std::function<void()> callback) {
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      queue.emplace(due, std::move(callback));
+    }
+    m_wake.notify_all();
+  }
+
+  void Run(Queue &queue) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    for (;;) {
+      if (queue.empty()) {
+        if (m_stopping) {
+          return;
+        }
+        m_wake.wait_until(lock, std::chrono::steady_clock::now() + std::chrono::seconds{1});
+        continue;
+      }
+      const auto next = queue.begin();
+      if (next->first > std::chrono::steady_clock::now() && !m_stopping) {
+        m_wake.wait_until(lock, next->first);
+        continue;
+      }
+      auto callback = std::move(next->second);
+      queue.erase(next);
+      lock.unlock();
+      callback();
+      lock.lock();
+    }
+  }
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake;
+  bool m_stopping{false};
+  Queue m_posted; // all due at once, so they run in posting order
+  Queue m_delayed;
+  std::thread m_uiThread;
+  std::thread m_timerThread;
+};
+
+} // namespace winrt::DateTimePicker::Helpers::Testing
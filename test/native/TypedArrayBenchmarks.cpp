@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "DateMath.h"
+#include "PickerTypedArrays.h"
+#include "TestClocks.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace winrt::DateTimePicker;
+using namespace winrt::DateTimePicker::Helpers;
+using namespace winrt::DateTimePicker::Helpers::Testing;
+
+namespace {
+
+// A large batch of dates, as sent from JS
+constexpr int64_t kElements = 100000;
+
+constexpr CalendarOffset kOffset{0, 1, 2};
+
+// Stands in for a JSValue: a tagged value per element, as a plain array reaches the TurboModule
+using BoxedValue = std::variant<std::monostate, bool, int64_t, double, std::string>;
+
+std::vector<double> YearOfTimestamps() {
+  std::mt19937_64 random{42};
+  std::uniform_int_distribution<int64_t> offset{0, 365 * kMillisecondsPerDay};
+  std::vector<double> values(kElements);
+  for (auto &value : values) {
+    value = static_cast<double>(UtcMilliseconds(2024, 1, 1) + offset(random));
+  }
+  return values;
+}
+
+// Reads the elements one by one, as the TurboModule's argument reader does
+std::vector<double> ReadBoxed(const std::vector<BoxedValue> &array) {
+  std::vector<double> values;
+  values.reserve(array.size());
+  for (const auto &element : array) {
+    if (const auto *number = std::get_if<double>(&element)) {
+      values.push_back(*number);
+    } else if (const auto *integer = std::get_if<int64_t>(&element)) {
+      values.push_back(static_cast<double>(*integer));
+    } else {
+      values.push_back(0);
+    }
+  }
+  return values;
+}
+
+// Writes the result back one element at a time, as the TurboModule's result writer does
+std::vector<BoxedValue> WriteBoxed(const std::vector<double> &values) {
+  std::vector<BoxedValue> array;
+  array.reserve(values.size());
+  for (const double value : values) {
+    array.emplace_back(value);
+  }
+  return array;
+}
+
+// Float64Array through the JSI function: the elements are updated in the array's buffer
+void BM_AddCalendarUnitsTypedArray(benchmark::State &state) {
+  const auto input = YearOfTimestamps();
+  std::vector<double> buffer;
+  for (auto _ : state) {
+    state.PauseTiming();
+    buffer = input;
+    state.ResumeTiming();
+    // What TimestampArrayFrom yields for the buffer
+    TimestampArray dates{std::span<double>{buffer}};
+    ZoneOffsets zone{int64_t{-5 * 3600}};
+    std::visit([&](auto elements) { AddCalendarOffset(elements, kOffset, zone); }, dates);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+BENCHMARK(BM_AddCalendarUnitsTypedArray)->Unit(benchmark::kMicrosecond);
+
+// Plain array through the TurboModule: each element is unboxed into a vector and boxed again
+void BM_AddCalendarUnitsBoxed(benchmark::State &state) {
+  const auto input = WriteBoxed(YearOfTimestamps());
+  for (auto _ : state) {
+    auto dates = ReadBoxed(input);
+    ZoneOffsets zone{int64_t{-5 * 3600}};
+    AddCalendarOffset(std::span<double>{dates}, kOffset, zone);
+    auto result = WriteBoxed(dates);
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+BENCHMARK(BM_AddCalendarUnitsBoxed)->Unit(benchmark::kMicrosecond);
+
+// The same split for a cheap operation, where the copies are most of the cost
+void BM_ClampDatesTypedArray(benchmark::State &state) {
+  const auto input = YearOfTimestamps();
+  const double minimum = static_cast<double>(UtcMilliseconds(2024, 4, 1));
+  const double maximum = static_cast<double>(UtcMilliseconds(2024, 10, 1));
+  std::vector<double> buffer;
+  for (auto _ : state) {
+    state.PauseTiming();
+    buffer = input;
+    state.ResumeTiming();
+    TimestampArray dates{std::span<double>{buffer}};
+    std::visit([&](auto elements) { ClampTimestamps(elements, minimum, maximum); }, dates);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+BENCHMARK(BM_ClampDatesTypedArray)->Unit(benchmark::kMicrosecond);
+
+void BM_ClampDatesBoxed(benchmark::State &state) {
+  const auto input = WriteBoxed(YearOfTimestamps());
+  const double minimum = static_cast<double>(UtcMilliseconds(2024, 4, 1));
+  const double maximum = static_cast<double>(UtcMilliseconds(2024, 10, 1));
+  for (auto _ : state) {
+    auto dates = ReadBoxed(input);
+    ClampTimestamps(std::span<double>{dates}, minimum, maximum);
+    auto result = WriteBoxed(dates);
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kElements);
+}
+BENCHMARK(BM_ClampDatesBoxed)->Unit(benchmark::kMicrosecond);
+
+} // namespace
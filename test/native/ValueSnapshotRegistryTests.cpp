@@ -0,0 +1,141 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "ValueSnapshotRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace winrt::DateTimePicker::Helpers;
+
+namespace {
+
+TEST(ValueSnapshotRegistry, ReadsPublishedValues) {
+  ValueSnapshotRegistry<16> registry;
+  auto *slot = registry.Register(7);
+  ASSERT_NE(slot, nullptr);
+  EXPECT_FALSE(registry.Read(7));
+
+  slot->Publish(1234);
+  EXPECT_EQ(registry.Read(7), 1234);
+  EXPECT_FALSE(registry.Read(8));
+
+  slot->Clear();
+  EXPECT_FALSE(registry.Read(7));
+}
+
+TEST(ValueSnapshotRegistry, UnregisterForgetsTheValue) {
+  ValueSnapshotRegistry<16> registry;
+  auto *slot = registry.Register(7);
+  ASSERT_NE(slot, nullptr);
+  slot->Publish(1);
+  registry.Unregister(slot);
+  EXPECT_FALSE(registry.Read(7));
+
+  // A new owner of the tag starts without a value
+  auto *again = registry.Register(7);
+  ASSERT_NE(again, nullptr);
+  EXPECT_FALSE(registry.Read(7));
+}
+
+TEST(ValueSnapshotRegistry, RegisterReturnsTheExistingSlotPastTombstones) {
+  // Fill small tables completely, so live tags sit behind the tombstones left in their chains
+  for (int64_t first = 1; first < 200; ++first) {
+    ValueSnapshotRegistry<4> registry;
+    std::vector<ValueSnapshotRegistry<4>::Slot *> slots;
+    for (int64_t tag = first; tag < first + 4; ++tag) {
+      slots.push_back(registry.Register(tag));
+      ASSERT_NE(slots.back(), nullptr);
+    }
+
+    for (size_t removed = 0; removed < slots.size(); ++removed) {
+      registry.Unregister(slots[removed]);
+      for (size_t live = removed + 1; live < slots.size(); ++live) {
+        EXPECT_EQ(registry.Register(first + static_cast<int64_t>(live)), slots[live]) << "tags from " << first;
+      }
+    }
+  }
+}
+
+TEST(ValueSnapshotRegistry, FailsOnlyWhenEveryTagIsLive) {
+  ValueSnapshotRegistry<8> registry;
+  std::vector<ValueSnapshotRegistry<8>::Slot *> slots;
+  for (int64_t tag = 1; tag <= 8; ++tag) {
+    slots.push_back(registry.Register(tag));
+    ASSERT_NE(slots.back(), nullptr);
+  }
+  EXPECT_EQ(registry.Register(9), nullptr);
+
+  registry.Unregister(slots[3]);
+  EXPECT_NE(registry.Register(9), nullptr);
+}
+
+TEST(ValueSnapshotRegistry, ReclaimsTombstonesAcrossMountCycles) {
+  ValueSnapshotRegistry<1024> registry;
+  // A few long-lived views while many others mount and unmount
+  std::vector<ValueSnapshotRegistry<1024>::Slot *> longLived;
+  for (int64_t tag = 1; tag <= 100; ++tag) {
+    longLived.push_back(registry.Register(tag));
+    ASSERT_NE(longLived.back(), nullptr);
+    longLived.back()->Publish(tag * 10);
+  }
+
+  for (int64_t tag = 1000; tag < 100000; tag += 2) {
+    auto *slot = registry.Register(tag);
+    ASSERT_NE(slot, nullptr) << tag;
+    slot->Publish(tag);
+    ASSERT_EQ(registry.Read(tag), tag);
+    registry.Unregister(slot);
+    ASSERT_LE(registry.Tombstones(), 1024u / 4);
+  }
+
+  EXPECT_GT(registry.Rebuilds(), 0u);
+  for (int64_t tag = 1; tag <= 100; ++tag) {
+    EXPECT_EQ(registry.Read(tag), tag * 10);
+    EXPECT_EQ(registry.Register(tag), longLived[static_cast<size_t>(tag - 1)]);
+  }
+}
+
+TEST(ValueSnapshotRegistry, ReadersNeverSeeAnotherTagsValue) {
+  ValueSnapshotRegistry<64> registry;
+  std::atomic<bool> done{false};
+
+  std::thread reader{[&] {
+    std::mt19937 random{1};
+    std::uniform_int_distribution<int64_t> tags{1, 200};
+    while (!done.load(std::memory_order_relaxed)) {
+      const int64_t tag = tags(random);
+      if (const auto value = registry.Read(tag)) {
+        ASSERT_EQ(*value, tag * 1000);
+      }
+    }
+  }};
+
+  std::mt19937 random{2};
+  std::uniform_int_distribution<int64_t> tags{1, 200};
+  std::vector<std::pair<int64_t, ValueSnapshotRegistry<64>::Slot *>> live;
+  for (int i = 0; i < 100000; ++i) {
+    if (live.size() < 40 && (live.empty() || random() % 2 == 0)) {
+      const int64_t tag = tags(random);
+      auto *slot = registry.Register(tag);
+      ASSERT_NE(slot, nullptr);
+      slot->Publish(tag * 1000);
+      if (std::find(live.begin(), live.end(), std::make_pair(tag, slot)) == live.end()) {
+        live.emplace_back(tag, slot);
+      }
+    } else {
+      const size_t victim = random() % live.size();
+      registry.Unregister(live[victim].second);
+      live.erase(live.begin() + static_cast<std::ptrdiff_t>(victim));
+    }
+  }
+  done.store(true, std::memory_order_relaxed);
+  reader.join();
+}
+
+} // namespace
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// Minimal stand-in for React Native's geometry types, so the iOS C++ helpers build without React.
+
+#pragma once
+
+namespace facebook {
+namespace react {
+
+// CGFloat on 64-bit Apple platforms
+using Float = double;
+
+struct Size {
+  Float width{0};
+  Float height{0};
+
+  bool operator==(const Size &other) const {
+    return width == other.width && height == other.height;
+  }
+
+  bool operator!=(const Size &other) const {
+    return !(*this == other);
+  }
+};
+
+} // namespace react
+} // namespace facebook
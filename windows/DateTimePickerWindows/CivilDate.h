@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Proleptic Gregorian calendar arithmetic on days since the Unix epoch.
+// Header-only and free of WinRT dependencies so it can be shared by the
+// XAML views, the TurboModules and portable unit tests.
+
+#include <cstdint>
+
+namespace winrt::DateTimePicker::Helpers {
+
+constexpr int64_t kSecondsPerDay = 24 * 3600;
+constexpr int64_t kMillisecondsPerDay = kSecondsPerDay * 1000;
+
+struct CivilDate {
+  int64_t year;
+  int32_t month; // 1-12
+  int32_t day;   // 1-31
+};
+
+/// <summary>
+/// Calendar fields delivered with change events when a picker opts in with includeFields,
+/// so JavaScript does not need to construct a Date to derive them.
+/// </summary>
+struct CalendarFields {
+  int32_t year;
+  int32_t month;     // 1-12
+  int32_t day;       // 1-31
+  int32_t weekday;   // 0 = Sunday ... 6 = Saturday
+  int32_t dayOfYear; // 1-366
+  int32_t isoWeek;   // 1-53
+};
+
+/// <summary>
+/// Floor division, so that instants before the epoch map to the preceding day.
+/// </summary>
+constexpr int64_t FloorDiv(int64_t value, int64_t divisor) noexcept {
+  return value / divisor - ((value % divisor != 0) && ((value < 0) != (divisor < 0)) ? 1 : 0);
+}
+
+/// <summary>
+/// Returns the number of days since 1970-01-01 for the given civil date.
+/// </summary>
+constexpr int64_t DaysFromCivil(int64_t year, int32_t month, int32_t day) noexcept {
+  year -= month <= 2 ? 1 : 0;
+  const int64_t era = FloorDiv(year, 400);
+  const int64_t yearOfEra = year - era * 400;
+  const int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+/// <summary>
+/// Returns the civil date for the given number of days since 1970-01-01.
+/// </summary>
+constexpr CivilDate CivilFromDays(int64_t days) noexcept {
+  days += 719468;
+  const int64_t era = FloorDiv(days, 146097);
+  const int64_t dayOfEra = days - era * 146097;
+  const int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const int64_t shiftedMonth = (5 * dayOfYear + 2) / 153;
+  const int32_t day = static_cast<int32_t>(dayOfYear - (153 * shiftedMonth + 2) / 5 + 1);
+  const int32_t month = static_cast<int32_t>(shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9);
+  return CivilDate{yearOfEra + era * 400 + (month <= 2 ? 1 : 0), month, day};
+}
+
+/// <summary>
+/// Returns the number of days in the given month (1-12).
+/// </summary>
+constexpr int32_t DaysInMonth(int64_t year, int32_t month) noexcept {
+  if (month == 2) {
+    const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return leap ? 29 : 28;
+  }
+  return month == 4 || month == 6 || month == 9 || month == 11 ? 30 : 31;
+}
+
+/// <summary>
+/// Returns the day of week (0 = Sunday ... 6 = Saturday) for days since 1970-01-01.
+/// </summary>
+constexpr int32_t WeekdayFromDays(int64_t days) noexcept {
+  return static_cast<int32_t>(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+}
+
+/// <summary>
+/// Computes calendar fields for a wall-clock instant, expressed as milliseconds since the
+/// epoch with the local UTC offset already applied.
+/// </summary>
+constexpr CalendarFields CalendarFieldsFromLocalMilliseconds(int64_t localMilliseconds) noexcept {
+  const int64_t days = FloorDiv(localMilliseconds, kMillisecondsPerDay);
+  const CivilDate date = CivilFromDays(days);
+  const int32_t weekday = WeekdayFromDays(days);
+
+  // ISO 8601 weeks start on Monday and belong to the year containing their Thursday.
+  const int32_t isoWeekday = weekday == 0 ? 7 : weekday;
+  const int64_t thursday = days - isoWeekday + 4;
+  const int64_t thursdayYear = CivilFromDays(thursday).year;
+  const int64_t isoWeek = (thursday - DaysFromCivil(thursdayYear, 1, 1)) / 7 + 1;
+
+  return CalendarFields{
+      static_cast<int32_t>(date.year),
+      date.month,
+      date.day,
+      weekday,
+      static_cast<int32_t>(days - DaysFromCivil(date.year, 1, 1) + 1),
+      static_cast<int32_t>(isoWeek)};
+}
+
+/// <summary>
+/// Copies calendar fields onto an event payload or module result with matching optional members.
+/// </summary>
+template <typename TTarget>
+void AssignCalendarFields(TTarget &target, const CalendarFields &fields) noexcept {
+  target.year = fields.year;
+  target.month = fields.month;
+  target.day = fields.day;
+  target.weekday = fields.weekday;
+  target.dayOfYear = fields.dayOfYear;
+  target.isoWeek = fields.isoWeek;
+}
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,466 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Batch date arithmetic over JavaScript timestamps (milliseconds since the Unix epoch), run on
+// the civil-date kernel instead of Date objects: calendar offsets with end-of-month clamping,
+// business-day offsets around weekends and holidays, clamping and range intersection.
+// Timestamps are doubles, as in number arrays and Float64Array, or int64, as in BigInt64Array,
+// and are updated in place. Header-only and free of WinRT dependencies.
+
+#include "CivilDate.h"
+#include "DayAnchor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Largest distance from the epoch a JavaScript Date can hold, in milliseconds.
+/// </summary>
+constexpr double kMaxTimeMilliseconds = 8.64e15;
+
+/// <summary>
+/// Converts a JavaScript timestamp to whole milliseconds the way Date does, or nullopt for
+/// NaN, infinities and values outside the Date range.
+/// </summary>
+inline std::optional<int64_t> TimeMillisecondsFrom(double value) noexcept {
+  if (!(std::abs(value) <= kMaxTimeMilliseconds)) {
+    return std::nullopt;
+  }
+  return static_cast<int64_t>(std::trunc(value));
+}
+
+/// <summary>
+/// Stand-in for an invalid Date in int64 timestamps, which have no NaN.
+/// </summary>
+constexpr int64_t kInvalidTimestamp64 = std::numeric_limits<int64_t>::min();
+
+/// <summary>
+/// Reads an int64 timestamp, or nullopt when it is outside the Date range.
+/// </summary>
+inline std::optional<int64_t> TimeMillisecondsFrom(int64_t value) noexcept {
+  constexpr auto kMax = static_cast<int64_t>(kMaxTimeMilliseconds);
+  if (value < -kMax || value > kMax) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+/// <summary>
+/// Converts whole milliseconds back to a timestamp, NaN (an invalid Date) when out of range.
+/// </summary>
+inline double TimestampFrom(int64_t milliseconds) noexcept {
+  const auto value = static_cast<double>(milliseconds);
+  return std::abs(value) <= kMaxTimeMilliseconds ? value : std::numeric_limits<double>::quiet_NaN();
+}
+
+/// <summary>
+/// Stores whole milliseconds into a timestamp element, or the element type's invalid value
+/// when there are none or they are out of range.
+/// </summary>
+inline void StoreTimestamp(double &element, std::optional<int64_t> milliseconds) noexcept {
+  element = milliseconds ? TimestampFrom(*milliseconds) : std::numeric_limits<double>::quiet_NaN();
+}
+
+inline void StoreTimestamp(int64_t &element, std::optional<int64_t> milliseconds) noexcept {
+  element = milliseconds ? TimeMillisecondsFrom(*milliseconds).value_or(kInvalidTimestamp64) : kInvalidTimestamp64;
+}
+
+/// <summary>
+/// Element types the batch operations accept.
+/// </summary>
+template <typename T>
+concept TimestampElement = std::is_same_v<T, double> || std::is_same_v<T, int64_t>;
+
+/// <summary>
+/// Largest offset accepted, in years, months, days or business days. Anything larger leaves
+/// the Date range whatever it is added to.
+/// </summary>
+constexpr double kMaxOffsetUnits = 2e8;
+
+/// <summary>
+/// Converts an offset count from JavaScript to whole units, or nullopt when it is not a
+/// number or out of range.
+/// </summary>
+inline std::optional<int64_t> OffsetUnitsFrom(double value) noexcept {
+  if (!(std::abs(value) <= kMaxOffsetUnits)) {
+    return std::nullopt;
+  }
+  return static_cast<int64_t>(std::trunc(value));
+}
+
+/// <summary>
+/// Local time of a batch: a fixed offset from UTC, or the rules of a clock. Remembers the last
+/// local day without a DST transition, so consecutive dates on the same day convert with one
+/// comparison instead of a time zone lookup.
+/// </summary>
+class ZoneOffsets {
+public:
+  explicit ZoneOffsets(int64_t fixedOffsetSeconds) noexcept
+      : m_clock(nullptr),
+        m_start(std::numeric_limits<int64_t>::min()),
+        m_end(std::numeric_limits<int64_t>::max()),
+        m_offset(fixedOffsetSeconds) {}
+
+  explicit ZoneOffsets(const IDayAnchorClock &clock) noexcept : m_clock(&clock) {}
+
+  /// <summary>
+  /// The fixed offset JavaScript passed as timeZoneOffsetInSeconds, or the clock's rules when
+  /// it passed none or one larger than a day.
+  /// </summary>
+  static ZoneOffsets From(std::optional<double> timeZoneOffsetInSeconds, const IDayAnchorClock &clock) noexcept {
+    if (timeZoneOffsetInSeconds && std::abs(*timeZoneOffsetInSeconds) <= kSecondsPerDay) {
+      return ZoneOffsets{static_cast<int64_t>(*timeZoneOffsetInSeconds)};
+    }
+    return ZoneOffsets{clock};
+  }
+
+  /// <summary>
+  /// Offset of local time from UTC, in seconds, in effect at the given UTC instant.
+  /// </summary>
+  int64_t AtUtcSeconds(int64_t utcSeconds) noexcept {
+    if (utcSeconds >= m_start && utcSeconds < m_end) {
+      return m_offset;
+    }
+
+    const int64_t offset = m_clock->UtcOffsetSecondsAt(utcSeconds);
+    const int64_t localSeconds = utcSeconds + offset;
+    const int64_t dayStart = utcSeconds - (localSeconds - FloorDiv(localSeconds, kSecondsPerDay) * kSecondsPerDay);
+    const int64_t dayEnd = dayStart + kSecondsPerDay;
+    if (m_clock->UtcOffsetSecondsAt(dayStart) == offset && m_clock->UtcOffsetSecondsAt(dayEnd - 1) == offset) {
+      m_start = dayStart;
+      m_end = dayEnd;
+      m_offset = offset;
+    }
+    return offset;
+  }
+
+  int64_t ToLocalMilliseconds(int64_t utcMilliseconds) noexcept {
+    return utcMilliseconds + AtUtcSeconds(FloorDiv(utcMilliseconds, 1000)) * 1000;
+  }
+
+  /// <summary>
+  /// Maps wall-clock milliseconds back to UTC. A wall-clock time skipped by a DST transition
+  /// maps past the transition; a repeated one maps to its first occurrence.
+  /// </summary>
+  int64_t ToUtcMilliseconds(int64_t localMilliseconds) noexcept {
+    const int64_t localSeconds = FloorDiv(localMilliseconds, 1000);
+    const int64_t cached = localSeconds - m_offset;
+    if (cached >= m_start && cached < m_end) {
+      return localMilliseconds - m_offset * 1000;
+    }
+    return localMilliseconds + (UtcSecondsFromLocal(localSeconds) - localSeconds) * 1000;
+  }
+
+private:
+  // Resolves a wall-clock time with the clock's rules. A skipped time yields two candidates
+  // that do not reproduce it; the later one is past the transition. A repeated time round-trips
+  // with the offsets on both sides, so the one in effect half a day earlier is tried first.
+  int64_t UtcSecondsFromLocal(int64_t localSeconds) noexcept {
+    const int64_t firstOffset = AtUtcSeconds(localSeconds - AtUtcSeconds(localSeconds));
+    const int64_t firstCandidate = localSeconds - firstOffset;
+    const int64_t secondOffset = AtUtcSeconds(firstCandidate);
+
+    int64_t utcSeconds = firstCandidate;
+    if (secondOffset != firstOffset) {
+      const int64_t secondCandidate = localSeconds - secondOffset;
+      utcSeconds = AtUtcSeconds(secondCandidate) == secondOffset ? secondCandidate
+                                                                 : std::max(firstCandidate, secondCandidate);
+    } else {
+      const int64_t earlierOffset = AtUtcSeconds(firstCandidate - kSecondsPerDay / 2);
+      const int64_t earlierCandidate = localSeconds - earlierOffset;
+      if (earlierCandidate < firstCandidate && AtUtcSeconds(earlierCandidate) == earlierOffset) {
+        utcSeconds = earlierCandidate;
+      }
+    }
+
+    // Leave the day of the result cached, so the next time on it takes the fast path
+    AtUtcSeconds(utcSeconds);
+    return utcSeconds;
+  }
+
+  const IDayAnchorClock *m_clock;
+  // UTC seconds [m_start, m_end) over which m_offset holds
+  int64_t m_start{0};
+  int64_t m_end{0};
+  int64_t m_offset{0};
+};
+
+/// <summary>
+/// Years, months and days to add to a date. Years and months move the calendar date and clamp
+/// the day to the end of the target month (Jan 31 + 1 month = Feb 28 or 29); days are added
+/// after that.
+/// </summary>
+struct CalendarOffset {
+  int64_t years{0};
+  int64_t months{0};
+  int64_t days{0};
+};
+
+/// <summary>
+/// Adds a calendar offset to every timestamp in place, keeping the local time of day.
+/// Invalid timestamps stay invalid.
+/// </summary>
+template <TimestampElement T>
+void AddCalendarOffset(std::span<T> values, const CalendarOffset &offset, ZoneOffsets &zone) noexcept {
+  const int64_t totalMonths = offset.years * 12 + offset.months;
+  for (auto &value : values) {
+    const auto milliseconds = TimeMillisecondsFrom(value);
+    if (!milliseconds) {
+      StoreTimestamp(value, std::nullopt);
+      continue;
+    }
+
+    const int64_t local = zone.ToLocalMilliseconds(*milliseconds);
+    const int64_t day = FloorDiv(local, kMillisecondsPerDay);
+    const int64_t timeOfDay = local - day * kMillisecondsPerDay;
+
+    int64_t targetDay = day;
+    if (totalMonths != 0) {
+      const CivilDate date = CivilFromDays(day);
+      const int64_t monthIndex = date.year * 12 + (date.month - 1) + totalMonths;
+      const int64_t year = FloorDiv(monthIndex, 12);
+      const auto month = static_cast<int32_t>(monthIndex - year * 12 + 1);
+      targetDay = DaysFromCivil(year, month, std::min(date.day, DaysInMonth(year, month)));
+    }
+    targetDay += offset.days;
+
+    StoreTimestamp(value, zone.ToUtcMilliseconds(targetDay * kMillisecondsPerDay + timeOfDay));
+  }
+}
+
+/// <summary>
+/// Working days: Monday to Friday, minus a set of holidays.
+/// </summary>
+class BusinessCalendar {
+public:
+  /// <summary>
+  /// Builds the calendar from holiday timestamps, each standing for its whole local day.
+  /// Holidays on weekends and invalid timestamps are ignored.
+  /// </summary>
+  template <TimestampElement T>
+  BusinessCalendar(std::span<const T> holidays, ZoneOffsets &zone) {
+    m_holidays.reserve(holidays.size());
+    for (const T holiday : holidays) {
+      if (const auto milliseconds = TimeMillisecondsFrom(holiday)) {
+        const int64_t day = FloorDiv(zone.ToLocalMilliseconds(*milliseconds), kMillisecondsPerDay);
+        if (IsWeekday(day)) {
+          m_holidays.push_back(day);
+        }
+      }
+    }
+    std::sort(m_holidays.begin(), m_holidays.end());
+    m_holidays.erase(std::unique(m_holidays.begin(), m_holidays.end()), m_holidays.end());
+  }
+
+  static bool IsWeekday(int64_t day) noexcept {
+    const int32_t weekday = WeekdayFromDays(day);
+    return weekday != 0 && weekday != 6;
+  }
+
+  bool IsBusinessDay(int64_t day) const noexcept {
+    return IsWeekday(day) && !std::binary_search(m_holidays.begin(), m_holidays.end(), day);
+  }
+
+  /// <summary>
+  /// Moves a day by the given number of business days; the day itself need not be one.
+  /// Zero returns the day unchanged.
+  /// </summary>
+  int64_t AddBusinessDays(int64_t day, int64_t count) const noexcept {
+    if (count == 0) {
+      return day;
+    }
+
+    // Skip weekends in closed form, then step over the holidays that fell inside the span
+    // just covered; holidays are weekdays, so each one costs exactly one more weekday
+    int64_t target = AddWeekdays(day, count);
+    int64_t skipped = count > 0 ? HolidaysIn(day + 1, target + 1) : HolidaysIn(target, day);
+    while (skipped > 0) {
+      const int64_t next = AddWeekdays(target, count > 0 ? skipped : -skipped);
+      skipped = count > 0 ? HolidaysIn(target + 1, next + 1) : HolidaysIn(next, target);
+      target = next;
+    }
+    return target;
+  }
+
+private:
+  // Monday = 0 ... Sunday = 6
+  static int64_t MondayBasedWeekday(int64_t day) noexcept {
+    return (WeekdayFromDays(day) + 6) % 7;
+  }
+
+  // Moves by count weekdays, ignoring holidays
+  static int64_t AddWeekdays(int64_t day, int64_t count) noexcept {
+    int64_t weekday = MondayBasedWeekday(day);
+    if (count > 0) {
+      if (weekday >= 5) {
+        // Count from the Friday before the weekend
+        day -= weekday - 4;
+        weekday = 4;
+      }
+      const int64_t remainder = count % 5;
+      day += count / 5 * 7;
+      return day + remainder + (weekday + remainder >= 5 ? 2 : 0);
+    }
+
+    count = -count;
+    if (weekday >= 5) {
+      // Count from the Monday after the weekend
+      day += 7 - weekday;
+      weekday = 0;
+    }
+    const int64_t remainder = count % 5;
+    day -= count / 5 * 7;
+    return day - remainder - (weekday - remainder < 0 ? 2 : 0);
+  }
+
+  // Holidays in the days [first, last)
+  int64_t HolidaysIn(int64_t first, int64_t last) const noexcept {
+    if (first >= last) {
+      return 0;
+    }
+    return std::lower_bound(m_holidays.begin(), m_holidays.end(), last) -
+        std::lower_bound(m_holidays.begin(), m_holidays.end(), first);
+  }
+
+  std::vector<int64_t> m_holidays; // sorted local days, weekdays only
+};
+
+/// <summary>
+/// Moves every timestamp by the given number of business days in place, keeping the local
+/// time of day. Invalid timestamps stay invalid.
+/// </summary>
+template <TimestampElement T>
+void AddBusinessDays(std::span<T> values, int64_t count, const BusinessCalendar &calendar, ZoneOffsets &zone) noexcept {
+  for (auto &value : values) {
+    const auto milliseconds = TimeMillisecondsFrom(value);
+    if (!milliseconds) {
+      StoreTimestamp(value, std::nullopt);
+      continue;
+    }
+
+    const int64_t local = zone.ToLocalMilliseconds(*milliseconds);
+    const int64_t day = FloorDiv(local, kMillisecondsPerDay);
+    const int64_t timeOfDay = local - day * kMillisecondsPerDay;
+    StoreTimestamp(value, zone.ToUtcMilliseconds(calendar.AddBusinessDays(day, count) * kMillisecondsPerDay + timeOfDay));
+  }
+}
+
+/// <summary>
+/// The next business days strictly after the given timestamp, at its local time of day.
+/// </summary>
+inline std::vector<double> NextBusinessDays(double start, size_t count, const BusinessCalendar &calendar, ZoneOffsets &zone) {
+  std::vector<double> days;
+  const auto milliseconds = TimeMillisecondsFrom(start);
+  if (!milliseconds) {
+    return days;
+  }
+
+  const int64_t local = zone.ToLocalMilliseconds(*milliseconds);
+  int64_t day = FloorDiv(local, kMillisecondsPerDay);
+  const int64_t timeOfDay = local - day * kMillisecondsPerDay;
+  days.reserve(count);
+  while (days.size() < count) {
+    day = calendar.AddBusinessDays(day, 1);
+    days.push_back(TimestampFrom(zone.ToUtcMilliseconds(day * kMillisecondsPerDay + timeOfDay)));
+  }
+  return days;
+}
+
+/// <summary>
+/// Clamps every timestamp into [minimum, maximum] in place; a missing bound leaves that side
+/// open. Invalid timestamps stay invalid.
+/// </summary>
+template <TimestampElement T>
+void ClampTimestamps(std::span<T> values, std::optional<double> minimum, std::optional<double> maximum) noexcept {
+  const double low = minimum.value_or(-std::numeric_limits<double>::infinity());
+  const double high = maximum.value_or(std::numeric_limits<double>::infinity());
+  for (auto &value : values) {
+    if constexpr (std::is_same_v<T, double>) {
+      if (value < low) {
+        value = low;
+      } else if (value > high) {
+        value = high;
+      }
+    } else if (value != kInvalidTimestamp64) {
+      // Valid int64 timestamps lie in the Date range, so bounds beyond it never apply
+      if (static_cast<double>(value) < low) {
+        value = static_cast<int64_t>(std::ceil(std::min(low, kMaxTimeMilliseconds)));
+      } else if (static_cast<double>(value) > high) {
+        value = static_cast<int64_t>(std::floor(std::max(high, -kMaxTimeMilliseconds)));
+      }
+    }
+  }
+}
+
+/// <summary>
+/// Intersects two sets of inclusive ranges, each given as flat [start, end, start, end, ...]
+/// pairs in any order and possibly overlapping. Returns the intersection as sorted, disjoint
+/// flat pairs. Pairs with NaN or with start after end are ignored.
+/// </summary>
+template <TimestampElement TFirst, TimestampElement TSecond>
+std::vector<double> IntersectRanges(std::span<const TFirst> first, std::span<const TSecond> second) {
+  using Range = std::pair<double, double>;
+  // Double bounds are taken as they are, so open ranges can use infinities
+  const auto bound = [](auto value) {
+    if constexpr (std::is_same_v<decltype(value), int64_t>) {
+      return value == kInvalidTimestamp64 ? std::numeric_limits<double>::quiet_NaN() : static_cast<double>(value);
+    } else {
+      return value;
+    }
+  };
+  const auto normalize = [&](auto flat) {
+    std::vector<Range> ranges;
+    ranges.reserve(flat.size() / 2);
+    for (size_t i = 0; i + 1 < flat.size(); i += 2) {
+      const double start = bound(flat[i]);
+      const double end = bound(flat[i + 1]);
+      if (start <= end) {
+        ranges.emplace_back(start, end);
+      }
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    size_t merged = 0;
+    for (const auto &range : ranges) {
+      if (merged > 0 && range.first <= ranges[merged - 1].second) {
+        ranges[merged - 1].second = std::max(ranges[merged - 1].second, range.second);
+      } else {
+        ranges[merged++] = range;
+      }
+    }
+    ranges.resize(merged);
+    return ranges;
+  };
+
+  const auto a = normalize(first);
+  const auto b = normalize(second);
+  std::vector<double> intersection;
+  for (size_t i = 0, j = 0; i < a.size() && j < b.size();) {
+    const double start = std::max(a[i].first, b[j].first);
+    const double end = std::min(a[i].second, b[j].second);
+    if (start <= end) {
+      intersection.push_back(start);
+      intersection.push_back(end);
+    }
+    if (a[i].second < b[j].second) {
+      ++i;
+    } else {
+      ++j;
+    }
+  }
+  return intersection;
+}
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -4,50 +4,65 @@
 #include "pch.h"
 #include "DatePickerComponent.h"
 #include "DateTimeHelpers.h"
+#include "PickerLogic.h"
+#include "XamlPickerControls.h"
 
 namespace winrt::DateTimePicker::Components {
 
 DatePickerComponent::DatePickerComponent()
     : m_control{winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker{}} {
 }
-}
 
-void DatePickerComponent::Open(
-    const ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerOpenParams& params,
-    DateChangedCallback callback) {
-  
-  // Store callback
-  m_dateChangedCallback = std::move(callback);
-  
-  // Store timezone offset
-  m_timeZoneOffsetInSeconds = static_cast<int64_t>(params.timeZoneOffsetInSeconds.value_or(0));
+Helpers::DateApplyPlan DatePickerComponent::BuildPlan(
+    const ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerOpenParams& params) {
+  Helpers::DateApplyPlan plan;
+  plan.timeZoneOffsetInSeconds = static_cast<int64_t>(params.timeZoneOffsetInSeconds.value_or(0));
 
-  // Set properties from params
   if (auto dayOfWeekFormat = params.dayOfWeekFormat) {
-    m_control.DayOfWeekFormat(winrt::to_hstring(*dayOfWeekFormat));
+    plan.dayOfWeekFormat.Set(winrt::to_hstring(*dayOfWeekFormat));
   }
 
   if (auto dateFormat = params.dateFormat) {
-    m_control.DateFormat(winrt::to_hstring(*dateFormat));
+    plan.dateFormat.Set(winrt::to_hstring(*dateFormat));
   }
 
   if (auto firstDayOfWeek = params.firstDayOfWeek) {
-    m_control.FirstDayOfWeek(
-        static_cast<winrt::Windows::Globalization::DayOfWeek>(*firstDayOfWeek));
+    plan.firstDayOfWeek.Set(*firstDayOfWeek);
   }
 
   if (auto minimumDate = params.minimumDate) {
-    m_control.MinDate(Helpers::DateTimeFrom(
-        static_cast<int64_t>(*minimumDate), m_timeZoneOffsetInSeconds));
+    plan.minDate.Set(Helpers::WallSecondsFromMilliseconds(
+        static_cast<int64_t>(*minimumDate), plan.timeZoneOffsetInSeconds));
   }
 
   if (auto maximumDate = params.maximumDate) {
-    m_control.MaxDate(Helpers::DateTimeFrom(
-        static_cast<int64_t>(*maximumDate), m_timeZoneOffsetInSeconds));
+    plan.maxDate.Set(Helpers::WallSecondsFromMilliseconds(
+        static_cast<int64_t>(*maximumDate), plan.timeZoneOffsetInSeconds));
   }
 
   if (auto placeholderText = params.placeholderText) {
-    m_control.PlaceholderText(winrt::to_hstring(*placeholderText));
+    plan.placeholderText.Set(winrt::to_hstring(*placeholderText));
+  }
+
+  Helpers::SharedApplyStats().plans.fetch_add(1, std::memory_order_relaxed);
+  return plan;
+}
+
+void DatePickerComponent::Open(const Helpers::DateApplyPlan& plan, DateChangedCallback callback) {
+  // Start from the default configuration; the component is reused across Open calls
+  Reset();
+  
+  // Store callback
+  m_dateChangedCallback = std::move(callback);
+  
+  // Store timezone offset
+  m_timeZoneOffsetInSeconds = plan.timeZoneOffsetInSeconds;
+
+  // Set properties from the plan
+  {
+    Helpers::ScopedApplyTimer timer;
+    Helpers::XamlDateControl<winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker> control{m_control};
+    Helpers::ApplyPlan(plan, control);
   }
 
   // Register event handler
@@ -57,6 +72,23 @@ void DatePickerComponent::Open(
       });
 }
 
+void DatePickerComponent::Reset() {
+  using winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker;
+
+  m_dateChangedRevoker.revoke();
+  m_dateChangedCallback = nullptr;
+  m_timeZoneOffsetInSeconds = 0;
+
+  m_control.IsCalendarOpen(false);
+  m_control.ClearValue(CalendarDatePicker::DateProperty());
+  m_control.ClearValue(CalendarDatePicker::DayOfWeekFormatProperty());
+  m_control.ClearValue(CalendarDatePicker::DateFormatProperty());
+  m_control.ClearValue(CalendarDatePicker::FirstDayOfWeekProperty());
+  m_control.ClearValue(CalendarDatePicker::MinDateProperty());
+  m_control.ClearValue(CalendarDatePicker::MaxDateProperty());
+  m_control.ClearValue(CalendarDatePicker::PlaceholderTextProperty());
+}
+
 winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker DatePickerComponent::GetControl() const {
   return m_control;
 }
@@ -69,7 +101,9 @@ void DatePickerComponent::OnDateChanged(
     const auto newDate = args.NewDate().Value();
     const auto timeInMilliseconds = Helpers::DateTimeToMilliseconds(newDate, m_timeZoneOffsetInSeconds);
     
-    m_dateChangedCallback(timeInMilliseconds, static_cast<int32_t>(m_timeZoneOffsetInSeconds));
+    // Invoked through a copy: the callback may Reset() this component
+    const auto callback = m_dateChangedCallback;
+    callback(timeInMilliseconds, static_cast<int32_t>(m_timeZoneOffsetInSeconds));
   }
 }
 
@@ -7,14 +7,21 @@
 
 #include "pch.h"
 #include "DatePickerModuleWindows.h"
+#include "CivilDate.h"
 
 #include <winrt/Microsoft.ReactNative.Xaml.h>
 #include <winrt/Microsoft.UI.Xaml.h>
 
 namespace winrt::DateTimePicker {
 
+DatePickerModule::~DatePickerModule() noexcept {
+  // The components are destroyed on the UI thread, never on the thread tearing down the module
+  SessionHost::Release(std::move(m_sessionHost));
+}
+
 void DatePickerModule::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   m_reactContext = reactContext;
+  m_sessionHost = std::make_shared<SessionHost>(GetPickerWindow(reactContext.Handle()));
 }
 
 // Called from JavaScript via DateTimePickerWindows.open() TurboModule API
@@ -29,55 +36,93 @@ void DatePickerModule::Initialize(winrt::Microsoft::ReactNative::ReactContext co
 // See: src/DateTimePickerWindows.windows.js and docs/windows-xaml-support.md
 void DatePickerModule::Open(ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerOpenParams &&params,
                             winrt::Microsoft::ReactNative::ReactPromise<ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerResult> promise) noexcept {
-  // Store the promise
-  m_currentPromise = promise;
-
-  // Create and open the date picker component
-  // Direct assignment automatically destroys any existing picker
-  // Note: This is separate from the Fabric component (DateTimePickerFabric.cpp)
-  // This component is used by the TurboModule for imperative API calls
-  m_datePickerComponent = std::make_unique<Components::DatePickerComponent>();
-  m_datePickerComponent->Open(params,
-      [this](const int64_t timestamp, const int32_t utcOffset) {
-        if (m_currentPromise) {
-          ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerResult result;
-          result.action = "dateSetAction";
-          result.timestamp = static_cast<double>(timestamp);
-          result.utcOffset = utcOffset;
-
-          m_currentPromise.Resolve(result);
-          m_currentPromise = nullptr;
-          
-          // Clean up the picker after resolving
-          m_datePickerComponent.reset();
-        }
-      });
-
-  // Note: This is a simplified implementation. A full implementation would:
-  // 1. Create a ContentDialog or Popup
-  // 2. Add the CalendarDatePicker to it
-  // 3. Show the dialog/popup
-  // 4. Handle OK/Cancel buttons
-  
-  // For now, the component is ready and waiting for user interaction
-  // The actual UI integration would depend on your app's structure
+  std::optional<std::chrono::milliseconds> timeout;
+  if (params.timeoutMs && *params.timeoutMs > 0) {
+    timeout = std::chrono::milliseconds{static_cast<int64_t>(*params.timeoutMs)};
+  }
+
+  // Opens without an id share id 0, so they replace each other as before
+  const auto id = static_cast<Helpers::PickerSessionId>(params.sessionId.value_or(0));
+
+  // All conversions happen here on the JS thread; the session only runs the control setters
+  // on the UI thread
+  RunSession(m_sessionHost, m_reactContext.Properties().Handle(), id, Components::DatePickerComponent::BuildPlan(params), params.includeFields.value_or(false), timeout, promise);
 }
 
-void DatePickerModule::Dismiss(winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept {
-  if (m_currentPromise) {
-    // Resolve the current picker promise with dismissed action
-    ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerResult result;
+Helpers::PickerTask DatePickerModule::RunSession(std::shared_ptr<SessionHost> host,
+                                                 winrt::Microsoft::ReactNative::IReactPropertyBag properties,
+                                                 Helpers::PickerSessionId id,
+                                                 Helpers::DateApplyPlan plan,
+                                                 bool includeFields,
+                                                 std::optional<std::chrono::milliseconds> timeout,
+                                                 winrt::Microsoft::ReactNative::ReactPromise<Result> promise) noexcept {
+  // Starting a session cancels the one it replaces, so that promise still settles
+  const auto session = host->sessions.Begin(id, timeout);
+
+  co_await Helpers::ResumeOn(host->dispatcher);
+
+  // The session may have been dismissed or replaced while this continuation was queued.
+  // Each session configures its own component, taken from the pool on the UI thread, so
+  // concurrent sessions never share a control. Note: This is separate from the Fabric component (DateTimePickerFabric.cpp)
+  std::unique_ptr<Components::DatePickerComponent> component;
+  std::optional<Helpers::PickerSessionDialog> dialog;
+  if (!session->IsResolved()) {
+    component = host->components.Acquire();
+    component->Open(plan, [session](const int64_t timestamp, const int32_t utcOffset) {
+      session->Resolve(Helpers::PickerSessionOutcome::Selected, DateSelection{timestamp, utcOffset});
+    });
+
+    // The session counts as open once the dialog is on screen, and closing the dialog dismisses it
+    dialog.emplace(
+        properties,
+        component->GetControl(),
+        [session]() { session->MarkOpen(); },
+        [session]() { session->Resolve(Helpers::PickerSessionOutcome::Dismissed); });
+  }
+
+  // Resumes on the UI thread once the session settles
+  const auto [outcome, selection] = co_await *session;
+  host->sessions.End(session);
+
+  // Hides the dialog when the session was settled elsewhere, and frees the control for the pool
+  if (dialog) {
+    dialog->Close();
+  }
+
+  // Returning the component here rather than in the selection callback keeps the control's own
+  // event handler off the stack. The pool resets it for the next session.
+  if (component) {
+    host->components.Release(std::move(component));
+  }
+  session->Close();
+
+  Result result;
+  result.sessionId = static_cast<double>(session->Id());
+  if (outcome == Helpers::PickerSessionOutcome::Selected && selection) {
+    result.action = "dateSetAction";
+    result.timestamp = static_cast<double>(selection->timestamp);
+    result.utcOffset = selection->utcOffset;
+    if (includeFields) {
+      Helpers::AssignCalendarFields(
+          result,
+          Helpers::CalendarFieldsFromLocalMilliseconds(selection->timestamp + static_cast<int64_t>(selection->utcOffset) * 1000));
+    }
+  } else {
     result.action = "dismissedAction";
     result.timestamp = 0;
     result.utcOffset = 0;
-
-    m_currentPromise.Resolve(result);
-    m_currentPromise = nullptr;
   }
+  promise.Resolve(result);
+}
 
-  // Clean up component
-  m_datePickerComponent.reset();
-  promise.Resolve(true);
+void DatePickerModule::Dismiss(std::optional<double> sessionId, winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept {
+  // Settles the pending opens with dismissedAction; their sessions return the components on the UI thread
+  if (sessionId) {
+    promise.Resolve(m_sessionHost->sessions.Dismiss(static_cast<Helpers::PickerSessionId>(*sessionId)));
+  } else {
+    m_sessionHost->sessions.DismissAll();
+    promise.Resolve(true);
+  }
 }
 
 } // namespace winrt::DateTimePicker
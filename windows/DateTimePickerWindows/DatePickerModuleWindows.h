@@ -5,14 +5,28 @@
 
 #include "NativeModules.h"
 #include "DatePickerComponent.h"
+#include "PickerSessionDialog.h"
+#include "PickerSessionHost.h"
+#include <chrono>
 #include <memory>
+#include <optional>
 
 namespace winrt::DateTimePicker {
 
+/// <summary>
+/// Date picked during an open session.
+/// </summary>
+struct DateSelection {
+  int64_t timestamp;
+  int32_t utcOffset;
+};
+
 REACT_MODULE(DatePickerModule)
 struct DatePickerModule {
   using ModuleSpec = ReactNativeSpecs::DatePickerModuleWindowsSpec;
 
+  ~DatePickerModule() noexcept;
+
   REACT_INIT(Initialize)
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
 
@@ -21,12 +35,26 @@ struct DatePickerModule {
             winrt::Microsoft::ReactNative::ReactPromise<ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerResult> promise) noexcept;
 
   REACT_METHOD(Dismiss, L"dismiss")
-  void Dismiss(winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept;
+  void Dismiss(std::optional<double> sessionId, winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept;
 
  private:
+  using Result = ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerResult;
+
+  using SessionHost = Helpers::PickerSessionHost<Components::DatePickerComponent, DateSelection>;
+
+  // Runs one open request: configures the picker on the UI thread, shows it in a dialog over
+  // the instance's window (see PickerSessionDialog.h) and settles the promise once the session
+  // is selected, dismissed, timed out or replaced by a newer open with the same id.
+  static Helpers::PickerTask RunSession(std::shared_ptr<SessionHost> host,
+                                        winrt::Microsoft::ReactNative::IReactPropertyBag properties,
+                                        Helpers::PickerSessionId id,
+                                        Helpers::DateApplyPlan plan,
+                                        bool includeFields,
+                                        std::optional<std::chrono::milliseconds> timeout,
+                                        winrt::Microsoft::ReactNative::ReactPromise<Result> promise) noexcept;
+
   winrt::Microsoft::ReactNative::ReactContext m_reactContext{nullptr};
-  std::unique_ptr<Components::DatePickerComponent> m_datePickerComponent;
-  winrt::Microsoft::ReactNative::ReactPromise<ReactNativeSpecs::DatePickerModuleWindowsSpec_DatePickerResult> m_currentPromise{nullptr};
+  std::shared_ptr<SessionHost> m_sessionHost;
 };
 
 } // namespace winrt::DateTimePicker
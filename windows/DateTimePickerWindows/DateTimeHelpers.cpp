@@ -3,9 +3,97 @@
 
 #include "pch.h"
 #include "DateTimeHelpers.h"
+#include "SharedCache.h"
+
+#include <winrt/Windows.Globalization.h>
+#include <winrt/Windows.Globalization.DateTimeFormatting.h>
+#include <winrt/Windows.System.UserProfile.h>
+
+#include <string>
+#include <unordered_map>
 
 namespace winrt::DateTimePicker::Helpers {
 
+namespace {
+
+using winrt::Windows::Globalization::DateTimeFormatting::DateTimeFormatter;
+
+// An empty clock selects the user's clock and languages
+DateTimeFormatter NewFormatter(std::wstring_view formatTemplate, const winrt::hstring &clock) {
+  if (clock.empty()) {
+    return DateTimeFormatter(formatTemplate);
+  }
+
+  using winrt::Windows::System::UserProfile::GlobalizationPreferences;
+  return DateTimeFormatter(
+      formatTemplate,
+      GlobalizationPreferences::Languages(),
+      GlobalizationPreferences::HomeGeographicRegion(),
+      winrt::Windows::Globalization::CalendarIdentifiers::Gregorian(),
+      clock);
+}
+
+// Templates come from props such as dateFormat, and DateTimeFormatter rejects invalid ones by
+// throwing. Prop updates are noexcept, so an invalid template formats with the default one.
+DateTimeFormatter CreateFormatter(
+    std::wstring_view formatTemplate,
+    std::wstring_view defaultTemplate,
+    const winrt::hstring &clock) {
+  try {
+    return NewFormatter(formatTemplate, clock);
+  } catch (const winrt::hresult_error &) {
+    if (formatTemplate == defaultTemplate) {
+      throw;
+    }
+    return NewFormatter(defaultTemplate, clock);
+  }
+}
+
+// Formatters by clock and template, shared by every thread. DateTimeFormatter is agile and
+// immutable once created, so one instance serves all views and modules; creating one is
+// costly, formatting with a cached one is not.
+using FormatterTable = std::unordered_map<std::wstring, DateTimeFormatter>;
+
+SharedCache<FormatterTable> &SharedFormatters() noexcept {
+  static SharedCache<FormatterTable> formatters;
+  return formatters;
+}
+
+std::wstring FormatterKey(std::wstring_view formatTemplate, std::wstring_view clock) {
+  std::wstring key;
+  key.reserve(clock.size() + 1 + formatTemplate.size());
+  key.append(clock).push_back(L'|');
+  key.append(formatTemplate);
+  return key;
+}
+
+// An empty clock selects the user's clock and languages, an empty time zone the local one
+winrt::hstring FormatWith(
+    std::wstring_view formatTemplate,
+    std::wstring_view defaultTemplate,
+    const winrt::hstring &clock,
+    winrt::Windows::Foundation::DateTime dateTime,
+    const winrt::hstring &timeZone) {
+  const auto key = FormatterKey(formatTemplate, clock);
+  const auto format = [&](const DateTimeFormatter &formatter) {
+    return timeZone.empty() ? formatter.Format(dateTime) : formatter.Format(dateTime, timeZone);
+  };
+
+  {
+    const auto formatters = SharedFormatters().Read();
+    if (const auto it = formatters->find(key); it != formatters->end()) {
+      return format(it->second);
+    }
+  }
+
+  // Cached under the requested template even when it fell back, so an invalid one is only tried once
+  auto formatter = CreateFormatter(formatTemplate, defaultTemplate, clock);
+  SharedFormatters().Update([&](FormatterTable &formatters) { return formatters.try_emplace(key, formatter).second; });
+  return format(formatter);
+}
+
+} // anonymous namespace
+
 winrt::Windows::Foundation::DateTime DateTimeFrom(int64_t timeInMilliseconds, int64_t timeZoneOffsetInSeconds) {
   const auto timeInSeconds = timeInMilliseconds / 1000;
   time_t ttWithTimeZoneOffset = static_cast<time_t>(timeInSeconds) + timeZoneOffsetInSeconds;
@@ -20,4 +108,28 @@ int64_t DateTimeToMilliseconds(winrt::Windows::Foundation::DateTime dateTime, in
   return ttInMilliseconds;
 }
 
+winrt::hstring FormatDate(winrt::Windows::Foundation::DateTime dateTime, std::wstring_view formatTemplate) {
+  constexpr std::wstring_view defaultTemplate{L"shortdate"};
+  return FormatWith(formatTemplate.empty() ? defaultTemplate : formatTemplate, defaultTemplate, {}, dateTime, {});
+}
+
+winrt::hstring FormatTime(winrt::Windows::Foundation::TimeSpan time, std::optional<bool> is24Hour) {
+  using winrt::Windows::Globalization::ClockIdentifiers;
+  const winrt::hstring clock = !is24Hour.has_value()
+      ? winrt::hstring{}
+      : (*is24Hour ? ClockIdentifiers::TwentyFourHour() : ClockIdentifiers::TwelveHour());
+
+  // Format the time on the epoch day in UTC, so no time zone shifts it
+  const winrt::Windows::Foundation::DateTime dateTime = winrt::clock::from_time_t(0) + time;
+  return FormatWith(L"shorttime", L"shorttime", clock, dateTime, L"UTC");
+}
+
+void ResetFormatters() noexcept {
+  try {
+    SharedFormatters().Publish(FormatterTable{});
+  } catch (...) {
+    // Out of memory; the old formatters keep serving
+  }
+}
+
 } // namespace winrt::DateTimePicker::Helpers
@@ -5,6 +5,9 @@
 
 #include <winrt/Windows.Foundation.h>
 
+#include <optional>
+#include <string_view>
+
 namespace winrt::DateTimePicker::Helpers {
 
 /// <summary>
@@ -23,4 +26,27 @@ winrt::Windows::Foundation::DateTime DateTimeFrom(int64_t timeInMilliseconds, in
 /// <returns>Time in milliseconds since Unix epoch</returns>
 int64_t DateTimeToMilliseconds(winrt::Windows::Foundation::DateTime dateTime, int64_t timeZoneOffsetInSeconds);
 
+/// <summary>
+/// Formats a date in the local time zone the way CalendarDatePicker displays it.
+/// Formatters are created once per template and shared by all threads.
+/// </summary>
+/// <param name="dateTime">Windows DateTime object</param>
+/// <param name="formatTemplate">DateTimeFormatter template, such as the picker's dateFormat ("shortdate" if empty or invalid)</param>
+/// <returns>Formatted date</returns>
+winrt::hstring FormatDate(winrt::Windows::Foundation::DateTime dateTime, std::wstring_view formatTemplate);
+
+/// <summary>
+/// Formats a time of day the way TimePicker displays it.
+/// </summary>
+/// <param name="time">Time since midnight</param>
+/// <param name="is24Hour">Whether to use a 24-hour clock; the user's clock when not set</param>
+/// <returns>Formatted time</returns>
+winrt::hstring FormatTime(winrt::Windows::Foundation::TimeSpan time, std::optional<bool> is24Hour);
+
+/// <summary>
+/// Drops the cached formatters, which captured the user's languages and clock when they were
+/// created. Formatting after this picks up the current settings.
+/// </summary>
+void ResetFormatters() noexcept;
+
 } // namespace winrt::DateTimePicker::Helpers
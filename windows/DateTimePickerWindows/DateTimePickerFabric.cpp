@@ -11,39 +11,291 @@
 
 #if defined(RNW_NEW_ARCH)
 
+#include "CivilDate.h"
 #include "DateTimeHelpers.h"
+#include "PickerEventBatchModuleWindows.h"
+#include "PickerIslandPool.h"
+#include "PickerWarmUpModuleWindows.h"
+#include "ValueSnapshotRegistry.h"
+#include "XamlPickerControls.h"
+
+#include <winrt/Microsoft.UI.h>
+#include <winrt/Microsoft.UI.Xaml.Input.h>
+#include <winrt/Microsoft.UI.Xaml.Media.h>
+
+#include <atomic>
 
 namespace winrt::DateTimePicker {
 
+namespace {
+
+// Batched events travel as a JSValue array, so the codegen event struct is flattened into an object
+winrt::Microsoft::ReactNative::JSValueObject ToBatchPayload(const Codegen::DateTimePicker_OnChange &eventArgs) {
+  winrt::Microsoft::ReactNative::JSValueObject payload;
+  payload["newDate"] = eventArgs.newDate;
+  if (eventArgs.year.has_value()) {
+    payload["year"] = *eventArgs.year;
+    payload["month"] = *eventArgs.month;
+    payload["day"] = *eventArgs.day;
+    payload["weekday"] = *eventArgs.weekday;
+    payload["dayOfYear"] = *eventArgs.dayOfYear;
+    payload["isoWeek"] = *eventArgs.isoWeek;
+  }
+  return payload;
+}
+
+using XamlDateControl = Helpers::XamlDateControl<winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker>;
+
+template <typename T>
+void PlanField(Helpers::DatePlanBuilder &builder, std::string_view name, const std::optional<T> &value) {
+  if (!value) {
+    builder.SetProp(name, Helpers::PickerPropValue{});
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    builder.SetProp(name, Helpers::PickerPropValue{*value});
+  } else {
+    builder.SetProp(name, Helpers::PickerPropValue{static_cast<int64_t>(*value)});
+  }
+}
+
+// Plans a prop just read into the codegen props, under the name DatePickerLogic uses
+void PlanDateProp(Helpers::DatePlanBuilder &builder, std::wstring_view propName, const Codegen::DateTimePickerProps &props) {
+  if (propName == L"selectedDate") {
+    PlanField(builder, "selectedDate", props.selectedDate);
+  } else if (propName == L"maximumDate") {
+    PlanField(builder, "maxDate", props.maximumDate);
+  } else if (propName == L"minimumDate") {
+    PlanField(builder, "minDate", props.minimumDate);
+  } else if (propName == L"timeZoneOffsetInSeconds") {
+    PlanField(builder, "timeZoneOffsetInSeconds", props.timeZoneOffsetInSeconds);
+  } else if (propName == L"dayOfWeekFormat") {
+    PlanField(builder, "dayOfWeekFormat", props.dayOfWeekFormat);
+  } else if (propName == L"dateFormat") {
+    PlanField(builder, "dateFormat", props.dateFormat);
+  } else if (propName == L"firstDayOfWeek") {
+    PlanField(builder, "firstDayOfWeek", props.firstDayOfWeek);
+  } else if (propName == L"placeholderText") {
+    PlanField(builder, "placeholderText", props.placeholderText);
+  } else if (propName == L"accessibilityLabel") {
+    PlanField(builder, "accessibilityLabel", props.accessibilityLabel);
+  }
+}
+
+std::atomic<uint64_t> s_propsGeneration{0};
+
+} // anonymous namespace
+
+DateTimePickerPlannedProps::DateTimePickerPlannedProps(
+    winrt::Microsoft::ReactNative::ViewProps props,
+    const winrt::Microsoft::ReactNative::IComponentProps &cloneFrom)
+    : m_generation(s_propsGeneration.fetch_add(1, std::memory_order_relaxed) + 1) {
+  if (cloneFrom) {
+    const auto cloneFromProps = cloneFrom.as<DateTimePickerPlannedProps>();
+    m_props = winrt::make_self<Codegen::DateTimePickerProps>(
+        props, cloneFromProps->m_props.as<winrt::Microsoft::ReactNative::IComponentProps>());
+    m_planBuilder = cloneFromProps->m_planBuilder;
+    m_planBuilder.ResetChanges();
+    m_clonedFromGeneration = cloneFromProps->m_generation;
+  } else {
+    m_props = winrt::make_self<Codegen::DateTimePickerProps>(props, nullptr);
+  }
+}
+
+void DateTimePickerPlannedProps::SetProp(
+    uint32_t hash,
+    winrt::hstring propName,
+    winrt::Microsoft::ReactNative::IJSValueReader value) noexcept {
+  m_props->SetProp(hash, propName, value);
+  PlanDateProp(m_planBuilder, propName, *m_props);
+}
+
 // DateTimePickerComponentView method implementations
 
 void DateTimePickerComponentView::InitializeContentIsland(
     const winrt::Microsoft::ReactNative::Composition::ContentIslandComponentView &islandView) noexcept {
-  m_xamlIsland = winrt::Microsoft::UI::Xaml::XamlIsland{};
-  m_calendarDatePicker = winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker{};
+  // A mounted picker has already paid the costs the idle warm-up would have
+  NotifyPickerMounted();
+
+  // Controls are pooled per UI thread; the new island hosts a reset pooled control (see PickerIslandPool.h).
+  // Lazy views hand the control back when their first props arrive.
+  auto pickerIsland = AcquireCalendarDatePickerIsland();
+  m_xamlIsland = std::move(pickerIsland.island);
+  m_calendarDatePicker = std::move(pickerIsland.control);
+  m_islandStateChangedRevoker = m_xamlIsland.ContentIsland().StateChanged(
+      winrt::auto_revoke, [this](const winrt::Microsoft::UI::Content::ContentIsland &island, const auto &args) {
+        if (args.DidSiteVisibleChange()) {
+          OnVisibilityChanged(m_offscreen.SetSiteVisible(island.IsSiteVisible()));
+        }
+      });
   islandView.Connect(m_xamlIsland.ContentIsland());
 
+  // Publish committed values for synchronous reads from JS (see PickerValuesModuleWindows.h)
+  m_tag = islandView.Tag();
+  m_reactContext = islandView.ReactContext();
+  m_window = GetPickerWindow(m_reactContext);
+  m_valueSlot = m_window->values.Register(m_tag);
+
+  // Only a weak reference, so the window's view list never keeps the view alive
+  m_liveViewId = m_window->views.Add([weakThis = get_weak()]() {
+    if (auto strongThis = weakThis.get()) {
+      strongThis->RefreshForLocaleChange();
+      return true;
+    }
+    return false;
+  });
+
   RegisterEvents();
-  
-  // Mount the CalendarDatePicker immediately so it's visible
-  m_xamlIsland.Content(m_calendarDatePicker);
 }
 
 void DateTimePickerComponentView::RegisterEvents() {
+  // Offscreen views register it when they come back
+  if (m_offscreen.IsOffscreen()) {
+    return;
+  }
+
   // Register the DateChanged event handler with auto_revoke
-  m_dateChangedRevoker = m_calendarDatePicker.DateChanged(winrt::auto_revoke, [this](auto &&sender, auto &&args) {
-    if (auto emitter = EventEmitter()) {
-      if (args.NewDate() != nullptr) {
-        auto newDate = args.NewDate().Value();
-        
-        // Convert DateTime to milliseconds
-        auto timeInMilliseconds = Helpers::DateTimeToMilliseconds(newDate, m_timeZoneOffsetInSeconds);
-        
-        Codegen::DateTimePicker_OnChange eventArgs;
-        eventArgs.newDate = timeInMilliseconds;
+  m_dateChangedRevoker = SubscribeDateChanged();
+}
+
+winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker::DateChanged_revoker
+DateTimePickerComponentView::SubscribeDateChanged() {
+  return m_calendarDatePicker.DateChanged(winrt::auto_revoke, [this](auto &&sender, auto &&args) {
+    if (args.NewDate() != nullptr) {
+      Helpers::CallbackEventEmitter emitter{[this](int64_t timeInMilliseconds) { DispatchDateChanged(timeInMilliseconds); }};
+      m_logic.OnDateChanged(XamlDateControl::WallSecondsFromDateTime(args.NewDate().Value()), emitter);
+    }
+  });
+}
+
+void DateTimePickerComponentView::BecomeLazy() {
+  // The island shows the placeholder from now on, and the control goes back to the pool
+  m_dateChangedRevoker.revoke();
+  ShowPlaceholder();
+  ReleaseCalendarDatePickerIsland({nullptr, std::move(m_calendarDatePicker)});
+}
+
+void DateTimePickerComponentView::ShowPlaceholder() {
+  namespace xaml = winrt::Microsoft::UI::Xaml;
+
+  m_placeholderText = xaml::Controls::TextBlock{};
+  m_placeholderText.VerticalAlignment(xaml::VerticalAlignment::Center);
+
+  // A transparent background makes the whole area, not just the text, receive pointer input
+  xaml::Controls::Grid hitArea;
+  hitArea.Background(xaml::Media::SolidColorBrush{winrt::Microsoft::UI::Colors::Transparent()});
+  hitArea.Children().Append(m_placeholderText);
+
+  m_placeholder = xaml::Controls::ContentControl{};
+  m_placeholder.IsTabStop(true);
+  m_placeholder.HorizontalContentAlignment(xaml::HorizontalAlignment::Stretch);
+  m_placeholder.VerticalContentAlignment(xaml::VerticalAlignment::Stretch);
+  m_placeholder.Content(hitArea);
+
+  m_placeholderGotFocusRevoker =
+      m_placeholder.GotFocus(winrt::auto_revoke, [this](auto &&, auto &&) { Materialize(true, false); });
+  m_placeholderPointerEnteredRevoker =
+      m_placeholder.PointerEntered(winrt::auto_revoke, [this](auto &&, auto &&) { Materialize(false, false); });
+  m_placeholderTappedRevoker =
+      m_placeholder.Tapped(winrt::auto_revoke, [this](auto &&, auto &&) { Materialize(false, true); });
+
+  m_xamlIsland.Content(m_placeholder);
+}
+
+void DateTimePickerComponentView::UpdatePlaceholder() {
+  if (!m_placeholder || !m_props) {
+    return;
+  }
+
+  // Shows what the plan would set on the control
+  const auto &plan = m_props->PlanSince(0);
+  if (plan.date.value) {
+    m_placeholderText.Text(Helpers::FormatDate(
+        winrt::clock::from_time_t(static_cast<time_t>(*plan.date.value)), plan.dateFormat.value.value_or(winrt::hstring{})));
+  } else {
+    m_placeholderText.Text(plan.placeholderText.value.value_or(winrt::hstring{}));
+  }
+
+  if (plan.name.value) {
+    m_placeholder.Name(*plan.name.value);
+  }
+}
+
+void DateTimePickerComponentView::Materialize(bool focus, bool openCalendar) {
+  if (m_calendarDatePicker || !m_xamlIsland) {
+    return;
+  }
+
+  m_placeholderGotFocusRevoker.revoke();
+  m_placeholderPointerEnteredRevoker.revoke();
+  m_placeholderTappedRevoker.revoke();
+
+  // Props received while lazy are applied before events are registered, so they do not fire onChange
+  m_calendarDatePicker = winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker{};
+  if (m_props) {
+    ApplyControlProps(m_props);
+  }
+  m_offscreen.DropPending();
+  RegisterEvents();
+
+  m_xamlIsland.Content(m_calendarDatePicker);
+  m_placeholder = nullptr;
+  m_placeholderText = nullptr;
+
+  if (focus) {
+    m_calendarDatePicker.Focus(winrt::Microsoft::UI::Xaml::FocusState::Programmatic);
+  }
+  if (openCalendar) {
+    m_calendarDatePicker.IsCalendarOpen(true);
+  }
+}
+
+DateTimePickerComponentView::~DateTimePickerComponentView() {
+  if (m_window) {
+    m_window->values.Unregister(m_valueSlot);
+    m_window->views.Remove(m_liveViewId);
+  }
+
+  // Return the island for reuse by the next view mounted on this thread. Lazy views that were
+  // never interacted with returned their control when they became lazy.
+  m_dateChangedRevoker.revoke();
+  m_islandStateChangedRevoker.revoke();
+  if (m_xamlIsland && m_calendarDatePicker) {
+    ReleaseCalendarDatePickerIsland({std::move(m_xamlIsland), std::move(m_calendarDatePicker)});
+  }
+}
+
+void DateTimePickerComponentView::DispatchDateChanged(int64_t timeInMilliseconds) {
+  if (m_valueSlot) {
+    m_valueSlot->Publish(timeInMilliseconds);
+  }
+
+  Codegen::DateTimePicker_OnChange eventArgs;
+  eventArgs.newDate = timeInMilliseconds;
+  if (m_includeFields) {
+    Helpers::AssignCalendarFields(
+        eventArgs,
+        Helpers::CalendarFieldsFromLocalMilliseconds(timeInMilliseconds + m_logic.TimeZoneOffsetInSeconds() * 1000));
+  }
+
+  if (m_window && IsPickerEventBatchingActive(*m_window)) {
+    // Delivered with the other pickers' events at the end of the frame
+    BatchPickerEvent(*m_window, m_tag, ToBatchPayload(eventArgs));
+  } else if (m_eventQueue.Push(std::move(eventArgs))) {
+    ScheduleEventDrain();
+  }
+}
+
+void DateTimePickerComponentView::ScheduleEventDrain() {
+  // Events are drained on the UI thread once the JS thread has caught up, so a busy JS thread
+  // sees a bounded backlog instead of every intermediate value (see EventQueue.h)
+  Helpers::PostToUIAfterJS(m_reactContext, get_weak(), [](DateTimePickerComponentView &view) {
+    view.m_eventQueue.Drain([&view](Codegen::DateTimePicker_OnChange &&eventArgs, bool valuesSkipped) {
+      if (valuesSkipped) {
+        eventArgs.valuesSkipped = true;
+      }
+      if (auto emitter = view.EventEmitter()) {
         emitter->onChange(eventArgs);
       }
-    }
+    });
   });
 }
 
@@ -63,80 +315,122 @@ void WithEventSuspended(TRevoker& revoker, TSetup setup, TAction action) {
 
 void DateTimePickerComponentView::UpdateProps(
     const winrt::Microsoft::ReactNative::ComponentView &view,
-    const winrt::com_ptr<Codegen::DateTimePickerProps> &newProps,
-    const winrt::com_ptr<Codegen::DateTimePickerProps> &oldProps) noexcept {
-  Codegen::BaseDateTimePicker<DateTimePickerComponentView>::UpdateProps(view, newProps, oldProps);
+    const winrt::com_ptr<DateTimePickerPlannedProps> &newProps,
+    const winrt::com_ptr<DateTimePickerPlannedProps> &oldProps) noexcept {
+  Codegen::BaseDateTimePicker<DateTimePickerComponentView>::UpdateProps(
+      view, newProps ? newProps->Props() : nullptr, oldProps ? oldProps->Props() : nullptr);
 
   if (!newProps) {
     return;
   }
 
+  // Only the first props decide whether the view is lazy
+  const bool firstProps = !m_props;
+
+  // Kept so a lazy view can apply them when its control is created
+  m_props = newProps;
+  const auto &props = *newProps->Props();
+
+  // Calendar fields are only computed for views that opt in
+  m_includeFields = props.includeFields.value_or(false);
+
+  if (props.selectedDate.has_value() && m_valueSlot) {
+    m_valueSlot->Publish(props.selectedDate.value());
+  }
+
+  if (firstProps && props.lazy.value_or(false)) {
+    BecomeLazy();
+  }
+
+  if (m_offscreen.IsOffscreen()) {
+    // Props are complete, so the latest ones replace any that are still pending
+    m_offscreen.Defer(newProps, [](auto &pending, auto &&update) { pending = std::move(update); });
+    return;
+  }
+
+  if (!m_calendarDatePicker) {
+    // Lazy views show the formatted value until the user interacts with them
+    UpdatePlaceholder();
+    return;
+  }
+
   // Suspend the DateChanged event while updating properties programmatically
   // to avoid triggering onChange events for prop changes from JavaScript
   WithEventSuspended(
     m_dateChangedRevoker,
-    [this]() {
-      return m_calendarDatePicker.DateChanged(winrt::auto_revoke, [this](auto &&sender, auto &&args) {
-        if (auto emitter = EventEmitter()) {
-          if (args.NewDate() != nullptr) {
-            auto newDate = args.NewDate().Value();
-            auto timeInMilliseconds = Helpers::DateTimeToMilliseconds(newDate, m_timeZoneOffsetInSeconds);
-            Codegen::DateTimePicker_OnChange eventArgs;
-            eventArgs.newDate = timeInMilliseconds;
-            emitter->onChange(eventArgs);
-          }
-        }
-      });
-    },
-    [this, &newProps]() {
-      // Update dayOfWeekFormat
-      if (newProps->dayOfWeekFormat.has_value()) {
-        m_calendarDatePicker.DayOfWeekFormat(winrt::to_hstring(newProps->dayOfWeekFormat.value()));
-      }
+    [this]() { return SubscribeDateChanged(); },
+    [this, &newProps]() { ApplyControlProps(newProps); }
+  );
+}
 
-      // Update dateFormat
-      if (newProps->dateFormat.has_value()) {
-        m_calendarDatePicker.DateFormat(winrt::to_hstring(newProps->dateFormat.value()));
-      }
+void DateTimePickerComponentView::RefreshForLocaleChange() {
+  if (!m_calendarDatePicker) {
+    // The shared formatters were reset, so this formats with the new settings
+    UpdatePlaceholder();
+    return;
+  }
 
-      // Update firstDayOfWeek
-      if (newProps->firstDayOfWeek.has_value()) {
-        m_calendarDatePicker.FirstDayOfWeek(
-            static_cast<winrt::Windows::Globalization::DayOfWeek>(newProps->firstDayOfWeek.value()));
-      }
+  if (!m_props) {
+    return;
+  }
 
-      // Update placeholderText
-      if (newProps->placeholderText.has_value()) {
-        m_calendarDatePicker.PlaceholderText(winrt::to_hstring(newProps->placeholderText.value()));
-      }
+  const auto refresh = [this]() {
+    // Setting an equal date does not re-format the displayed text
+    if (m_props->Props()->selectedDate.has_value()) {
+      m_calendarDatePicker.Date(nullptr);
+    }
+    m_appliedGeneration = 0;
+    ApplyControlProps(m_props);
+  };
 
-      // Store timezone offset
-      if (newProps->timeZoneOffsetInSeconds.has_value()) {
-        m_timeZoneOffsetInSeconds = newProps->timeZoneOffsetInSeconds.value();
-      } else {
-        m_timeZoneOffsetInSeconds = 0;
-      }
+  if (m_offscreen.IsOffscreen()) {
+    // The handler is already detached, and the latest props are now applied
+    refresh();
+    m_offscreen.DropPending();
+  } else {
+    WithEventSuspended(m_dateChangedRevoker, [this]() { return SubscribeDateChanged(); }, refresh);
+  }
+}
 
-      // Update min/max dates
-      if (newProps->minimumDate.has_value()) {
-        m_calendarDatePicker.MinDate(Helpers::DateTimeFrom(newProps->minimumDate.value(), m_timeZoneOffsetInSeconds));
-      }
+void DateTimePickerComponentView::UpdateLayoutMetrics(
+    const winrt::Microsoft::ReactNative::ComponentView &view,
+    const winrt::Microsoft::ReactNative::LayoutMetrics &newLayoutMetrics,
+    const winrt::Microsoft::ReactNative::LayoutMetrics &oldLayoutMetrics) noexcept {
+  Codegen::BaseDateTimePicker<DateTimePickerComponentView>::UpdateLayoutMetrics(view, newLayoutMetrics, oldLayoutMetrics);
 
-      if (newProps->maximumDate.has_value()) {
-        m_calendarDatePicker.MaxDate(Helpers::DateTimeFrom(newProps->maximumDate.value(), m_timeZoneOffsetInSeconds));
-      }
+  // A collapsed parent or display: none lays the view out with no area
+  OnVisibilityChanged(m_offscreen.SetLayoutSize(newLayoutMetrics.Frame.Width, newLayoutMetrics.Frame.Height));
+}
 
-      // Update selected date
-      if (newProps->selectedDate.has_value()) {
-        m_calendarDatePicker.Date(Helpers::DateTimeFrom(newProps->selectedDate.value(), m_timeZoneOffsetInSeconds));
-      }
+void DateTimePickerComponentView::OnVisibilityChanged(OffscreenProps::Transition transition) {
+  if (transition == OffscreenProps::Transition::Hidden) {
+    m_dateChangedRevoker.revoke();
+    return;
+  }
 
-      // Update accessibilityLabel (using Name property)
-      if (newProps->accessibilityLabel.has_value()) {
-        m_calendarDatePicker.Name(winrt::to_hstring(newProps->accessibilityLabel.value()));
-      }
+  if (transition != OffscreenProps::Transition::Shown) {
+    return;
+  }
+
+  // Applied before the handler is back, so the held-back props do not fire onChange
+  if (const auto pending = m_offscreen.TakePending()) {
+    if (m_calendarDatePicker) {
+      ApplyControlProps(*pending);
+    } else {
+      UpdatePlaceholder();
     }
-  );
+  }
+
+  if (m_calendarDatePicker) {
+    RegisterEvents();
+  }
+}
+
+void DateTimePickerComponentView::ApplyControlProps(const winrt::com_ptr<DateTimePickerPlannedProps> &props) {
+  // The plan was built when the props were parsed
+  XamlDateControl control{m_calendarDatePicker};
+  m_logic.Apply(props->PlanSince(m_appliedGeneration), control);
+  m_appliedGeneration = props->Generation();
 }
 
 } // namespace winrt::DateTimePicker
@@ -146,7 +440,25 @@ void RegisterDateTimePickerComponentView(winrt::Microsoft::ReactNative::IReactPa
       winrt::DateTimePicker::DateTimePickerComponentView>(
       packageBuilder,
       [](const winrt::Microsoft::ReactNative::Composition::IReactCompositionViewComponentBuilder &builder) {
-        builder.as<winrt::Microsoft::ReactNative::IReactViewComponentBuilder>().XamlSupport(true);
+        auto viewBuilder = builder.as<winrt::Microsoft::ReactNative::IReactViewComponentBuilder>();
+        viewBuilder.XamlSupport(true);
+
+        // Replaces the codegen props, so every update arrives with its plan
+        viewBuilder.SetCreateProps([](winrt::Microsoft::ReactNative::ViewProps props,
+                                      const winrt::Microsoft::ReactNative::IComponentProps &cloneFrom) noexcept {
+          return winrt::make<winrt::DateTimePicker::DateTimePickerPlannedProps>(props, cloneFrom);
+        });
+        viewBuilder.SetUpdatePropsHandler([](const winrt::Microsoft::ReactNative::ComponentView &view,
+                                             const winrt::Microsoft::ReactNative::IComponentProps &newProps,
+                                             const winrt::Microsoft::ReactNative::IComponentProps &oldProps) noexcept {
+          using winrt::DateTimePicker::DateTimePickerPlannedProps;
+          auto userData = view.UserData().as<winrt::DateTimePicker::DateTimePickerComponentView>();
+          userData->UpdateProps(
+              view,
+              newProps ? newProps.as<DateTimePickerPlannedProps>() : nullptr,
+              oldProps ? oldProps.as<DateTimePickerPlannedProps>() : nullptr);
+        });
+
         builder.SetContentIslandComponentViewInitializer(
             [](const winrt::Microsoft::ReactNative::Composition::ContentIslandComponentView &islandView) noexcept {
               auto userData = winrt::make_self<winrt::DateTimePicker::DateTimePickerComponentView>();
@@ -6,7 +6,12 @@
 #if defined(RNW_NEW_ARCH)
 
 #include "codegen/react/components/DateTimePicker/DateTimePicker.g.h"
+#include "EventQueue.h"
+#include "OffscreenUpdates.h"
+#include "PickerLogic.h"
+#include "PickerWindow.h"
 
+#include <winrt/Microsoft.UI.Content.h>
 #include <winrt/Microsoft.UI.Xaml.Controls.h>
 #include <winrt/Windows.Globalization.h>
 #include <winrt/Microsoft.ReactNative.Xaml.h>
@@ -14,25 +19,105 @@
 
 namespace winrt::DateTimePicker {
 
+// Props of a DateTimePicker view. They wrap the codegen props and plan the control update as
+// each prop is parsed, on the JS thread, so the UI thread only applies the plan.
+struct DateTimePickerPlannedProps
+    : winrt::implements<DateTimePickerPlannedProps, winrt::Microsoft::ReactNative::IComponentProps> {
+  DateTimePickerPlannedProps(
+      winrt::Microsoft::ReactNative::ViewProps props,
+      const winrt::Microsoft::ReactNative::IComponentProps &cloneFrom);
+
+  void SetProp(uint32_t hash, winrt::hstring propName, winrt::Microsoft::ReactNative::IJSValueReader value) noexcept;
+
+  const winrt::com_ptr<Codegen::DateTimePickerProps> &Props() const noexcept {
+    return m_props;
+  }
+
+  // Identifies these props to the view that applies them
+  uint64_t Generation() const noexcept {
+    return m_generation;
+  }
+
+  // Setters that bring a control showing the props of the given generation up to these props.
+  // Only the parsed changes when these props were cloned from that generation, otherwise every
+  // prop set so far; generation 0 is a control that has shown no props.
+  const Helpers::DateApplyPlan &PlanSince(uint64_t appliedGeneration) const noexcept {
+    return appliedGeneration != 0 && appliedGeneration == m_clonedFromGeneration ? m_planBuilder.Changes()
+                                                                                 : m_planBuilder.All();
+  }
+
+private:
+  winrt::com_ptr<Codegen::DateTimePickerProps> m_props;
+  Helpers::DatePlanBuilder m_planBuilder;
+  uint64_t m_generation;
+  uint64_t m_clonedFromGeneration{0};
+};
+
 // DateTimePickerComponentView implements the Fabric architecture for DateTimePicker
-// using XAML CalendarDatePicker hosted in a XamlIsland
+// using XAML CalendarDatePicker hosted in a XamlIsland. With the lazy prop the control is
+// only created once the user interacts with the view.
 struct DateTimePickerComponentView : public winrt::implements<DateTimePickerComponentView, winrt::IInspectable>,
                                      Codegen::BaseDateTimePicker<DateTimePickerComponentView> {
+  ~DateTimePickerComponentView();
+
   void InitializeContentIsland(
       const winrt::Microsoft::ReactNative::Composition::ContentIslandComponentView &islandView) noexcept;
 
   void RegisterEvents();
 
+  // Replaces the codegen UpdateProps, since the view registers DateTimePickerPlannedProps
   void UpdateProps(
       const winrt::Microsoft::ReactNative::ComponentView &view,
-      const winrt::com_ptr<Codegen::DateTimePickerProps> &newProps,
-      const winrt::com_ptr<Codegen::DateTimePickerProps> &oldProps) noexcept override;
+      const winrt::com_ptr<DateTimePickerPlannedProps> &newProps,
+      const winrt::com_ptr<DateTimePickerPlannedProps> &oldProps) noexcept;
+
+  void UpdateLayoutMetrics(
+      const winrt::Microsoft::ReactNative::ComponentView &view,
+      const winrt::Microsoft::ReactNative::LayoutMetrics &newLayoutMetrics,
+      const winrt::Microsoft::ReactNative::LayoutMetrics &oldLayoutMetrics) noexcept override;
 
 private:
+  void DispatchDateChanged(int64_t timeInMilliseconds);
+  void ScheduleEventDrain();
+  winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker::DateChanged_revoker SubscribeDateChanged();
+  void ApplyControlProps(const winrt::com_ptr<DateTimePickerPlannedProps> &props);
+
+  // Lazy views show their value in a TextBlock and only create the CalendarDatePicker
+  // on focus, pointer-over or tap
+  void BecomeLazy();
+  void ShowPlaceholder();
+  void UpdatePlaceholder();
+  void Materialize(bool focus, bool openCalendar);
+
+  // Re-applies the formatted value and control props after a time zone or language change
+  // (see BroadcastTimeZoneOrLocaleChange)
+  void RefreshForLocaleChange();
+
+  // Offscreen views keep their island but detach the DateChanged handler and hold back prop
+  // updates, applying only the latest props when they come back (see OffscreenUpdates.h)
+  using OffscreenProps = Helpers::OffscreenUpdates<winrt::com_ptr<DateTimePickerPlannedProps>>;
+  void OnVisibilityChanged(OffscreenProps::Transition transition);
+
   winrt::Microsoft::UI::Xaml::XamlIsland m_xamlIsland{nullptr};
   winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker m_calendarDatePicker{nullptr};
   winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker::DateChanged_revoker m_dateChangedRevoker;
-  int64_t m_timeZoneOffsetInSeconds = 0;
+  winrt::com_ptr<DateTimePickerPlannedProps> m_props;
+  uint64_t m_appliedGeneration{0}; // of the props last set on the control
+  Helpers::DatePickerLogic m_logic;
+  winrt::Microsoft::UI::Xaml::Controls::ContentControl m_placeholder{nullptr};
+  winrt::Microsoft::UI::Xaml::Controls::TextBlock m_placeholderText{nullptr};
+  winrt::Microsoft::UI::Xaml::UIElement::GotFocus_revoker m_placeholderGotFocusRevoker;
+  winrt::Microsoft::UI::Xaml::UIElement::PointerEntered_revoker m_placeholderPointerEnteredRevoker;
+  winrt::Microsoft::UI::Xaml::UIElement::Tapped_revoker m_placeholderTappedRevoker;
+  winrt::Microsoft::UI::Content::ContentIsland::StateChanged_revoker m_islandStateChangedRevoker;
+  OffscreenProps m_offscreen;
+  bool m_includeFields = false;
+  int64_t m_tag = 0;
+  winrt::Microsoft::ReactNative::IReactContext m_reactContext{nullptr};
+  Helpers::PickerEventQueue<Codegen::DateTimePicker_OnChange> m_eventQueue;
+  std::shared_ptr<PickerWindow> m_window; // bound when the island is initialized
+  Helpers::PickerValueRegistry::Slot *m_valueSlot{nullptr};
+  Helpers::LivePickerViews::ViewId m_liveViewId{0};
 };
 
 } // namespace winrt::DateTimePicker
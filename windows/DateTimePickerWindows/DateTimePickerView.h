@@ -6,6 +6,9 @@
 #include "DateTimePickerView.g.h"
 #include "winrt/Microsoft.ReactNative.h"
 #include "NativeModules.h"
+#include "EventQueue.h"
+#include "PickerLogic.h"
+#include "XamlPickerControls.h"
 
 namespace winrt::DateTimePicker::implementation {
     
@@ -17,17 +20,18 @@ namespace winrt::DateTimePicker::implementation {
         void UpdateProperties(Microsoft::ReactNative::IJSValueReader const& reader);
 
     private:
+        using XamlDateControl = Helpers::XamlDateControl<xaml::Controls::CalendarDatePicker>;
+
         Microsoft::ReactNative::IReactContext m_reactContext{ nullptr };
-        bool m_updating{ false };
         xaml::Controls::CalendarDatePicker::DateChanged_revoker m_dataPickerDateChangedRevoker{};
 
         void RegisterEvents();
         void OnDateChanged(winrt::Windows::Foundation::IInspectable const& sender, xaml::Controls::CalendarDatePickerDateChangedEventArgs const& args);
-        winrt::Windows::Foundation::DateTime DateTimeFrom(int64_t timeInMilliSeconds, int64_t timeZoneOffsetInSeconds);
-        int64_t DateTimeToMiliseconds(winrt::Windows::Foundation::DateTime dateTime, int64_t timeZoneOffsetInSeconds);
+        void QueueChangeEvent(int64_t timeInMilliseconds);
+        void DispatchChangeEvent(int64_t timeInMilliseconds, bool valuesSkipped);
 
-        int64_t m_selectedTime, m_maxTime, m_minTime; // These values are expected to be in milliseconds.
-        int64_t m_timeZoneOffsetInSeconds = 0;        // Timezone offset is expected to be in seconds.
+        Helpers::DatePickerLogic m_logic;
+        Helpers::PickerEventQueue<int64_t> m_eventQueue;
     };
 }
 
@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "DayAnchor.h"
+
+#include <winrt/Windows.System.Threading.h>
+
+#include <chrono>
+#include <ctime>
+#include <mutex>
+
+namespace winrt::DateTimePicker::Helpers {
+
+namespace {
+
+class LocalSystemClock final : public IDayAnchorClock {
+public:
+  int64_t NowMilliseconds() const noexcept override {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+  }
+
+  int64_t UtcOffsetSecondsAt(int64_t utcSeconds) const noexcept override {
+    const time_t tt = static_cast<time_t>(utcSeconds);
+    std::tm local{};
+    if (localtime_s(&local, &tt) != 0) {
+      return 0;
+    }
+
+    const int64_t localSeconds = DaysFromCivil(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday) * kSecondsPerDay +
+        local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+    return localSeconds - utcSeconds;
+  }
+};
+
+std::mutex g_refreshTimerMutex;
+winrt::Windows::System::Threading::ThreadPoolTimer g_refreshTimer{nullptr};
+
+void ScheduleRefresh(DayAnchor &anchor, int64_t delayInMilliseconds) noexcept {
+  std::lock_guard<std::mutex> lock(g_refreshTimerMutex);
+  if (g_refreshTimer) {
+    g_refreshTimer.Cancel();
+  }
+
+  // Fire just past the boundary; an early wake-up simply reschedules for the remainder.
+  g_refreshTimer = winrt::Windows::System::Threading::ThreadPoolTimer::CreateTimer(
+      [&anchor](auto const & /*timer*/) { ScheduleRefresh(anchor, anchor.Refresh()); },
+      std::chrono::milliseconds(delayInMilliseconds + 1));
+}
+
+} // anonymous namespace
+
+std::shared_ptr<const IDayAnchorClock> SystemClock() noexcept {
+  static const auto clock = std::make_shared<LocalSystemClock>();
+  return clock;
+}
+
+DayAnchor &SharedDayAnchor() noexcept {
+  static DayAnchor anchor{SystemClock()};
+  static std::once_flag timerStarted;
+  // The constructor has refreshed the anchor; only the timer is left to start
+  std::call_once(timerStarted, [] { ScheduleRefresh(anchor, anchor.MillisecondsUntilNextBoundary()); });
+  return anchor;
+}
+
+void NotifyTimeZoneChanged() noexcept {
+  _tzset();
+  auto &anchor = SharedDayAnchor();
+  ScheduleRefresh(anchor, anchor.Refresh());
+}
+
+} // namespace winrt::DateTimePicker::Helpers
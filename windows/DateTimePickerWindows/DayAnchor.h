@@ -0,0 +1,196 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CivilDate.h"
+#include "SharedCache.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Source of the current time and the local time zone rules.
+/// Production code uses the system clock; tests inject a fake to cross midnight and DST boundaries.
+/// </summary>
+class IDayAnchorClock {
+public:
+  virtual ~IDayAnchorClock() = default;
+
+  /// <summary>
+  /// Current UTC time in milliseconds since Unix epoch.
+  /// </summary>
+  virtual int64_t NowMilliseconds() const noexcept = 0;
+
+  /// <summary>
+  /// Offset of local time from UTC, in seconds, in effect at the given UTC instant.
+  /// </summary>
+  virtual int64_t UtcOffsetSecondsAt(int64_t utcSeconds) const noexcept = 0;
+};
+
+/// <summary>
+/// The local day the anchor currently describes, published as one snapshot so readers never
+/// pair the midnight of one day with the boundary of another.
+/// </summary>
+struct AnchoredDay {
+  int64_t localDay{0};      // the local date, in days since the Unix epoch
+  int64_t localMidnight{0}; // UTC milliseconds of the day's local midnight
+  int64_t nextBoundary{0};  // UTC milliseconds of the next local midnight
+  // Offset from UTC, in seconds, when it holds for the whole day, i.e. no DST transition
+  // falls inside it
+  std::optional<int64_t> uniformOffsetSeconds;
+};
+
+/// <summary>
+/// Caches the UTC instant of today's local midnight so that change events can turn a
+/// time of day into a timestamp with a single add, and today's UTC offset so that converting
+/// an instant of today skips the time zone rules. The owner calls Refresh() when the
+/// returned delay elapses (next local day boundary) or when the time zone changes.
+/// </summary>
+class DayAnchor {
+public:
+  explicit DayAnchor(std::shared_ptr<const IDayAnchorClock> clock) noexcept : m_clock(std::move(clock)) {
+    Refresh();
+  }
+
+  /// <summary>
+  /// The current local day. Reads never block, also while Refresh() runs on another thread.
+  /// </summary>
+  AnchoredDay Today() const noexcept {
+    return *m_today.Read();
+  }
+
+  /// <summary>
+  /// UTC milliseconds of the most recent local midnight.
+  /// </summary>
+  int64_t LocalMidnightMilliseconds() const noexcept {
+    return m_today.Read()->localMidnight;
+  }
+
+  /// <summary>
+  /// UTC milliseconds of the next local midnight, at which the anchor becomes stale.
+  /// </summary>
+  int64_t NextBoundaryMilliseconds() const noexcept {
+    return m_today.Read()->nextBoundary;
+  }
+
+  /// <summary>
+  /// Milliseconds from now until the anchor becomes stale, without recomputing it.
+  /// </summary>
+  int64_t MillisecondsUntilNextBoundary() const noexcept {
+    return std::max<int64_t>(NextBoundaryMilliseconds() - m_clock->NowMilliseconds(), 0);
+  }
+
+  /// <summary>
+  /// Recomputes the anchor from the clock.
+  /// </summary>
+  /// <returns>Milliseconds until the next local day boundary</returns>
+  int64_t Refresh() noexcept {
+    const int64_t nowMilliseconds = m_clock->NowMilliseconds();
+    const int64_t nowSeconds = FloorDiv(nowMilliseconds, 1000);
+    const int64_t localDay = FloorDiv(nowSeconds + m_clock->UtcOffsetSecondsAt(nowSeconds), kSecondsPerDay);
+
+    AnchoredDay today;
+    today.localDay = localDay;
+    today.localMidnight = UtcSecondsFromLocal(localDay * kSecondsPerDay) * 1000;
+    today.nextBoundary = UtcSecondsFromLocal((localDay + 1) * kSecondsPerDay) * 1000;
+    const int64_t offsetAtMidnight = m_clock->UtcOffsetSecondsAt(today.localMidnight / 1000);
+    if (offsetAtMidnight == m_clock->UtcOffsetSecondsAt(today.nextBoundary / 1000 - 1)) {
+      today.uniformOffsetSeconds = offsetAtMidnight;
+    }
+    const int64_t nextBoundary = today.nextBoundary;
+    try {
+      m_today.Publish(std::move(today));
+    } catch (...) {
+      // Out of memory; keep serving the previous day and retry at the next refresh
+      return 60 * 1000;
+    }
+
+    return std::max<int64_t>(nextBoundary - nowMilliseconds, 0);
+  }
+
+  /// <summary>
+  /// Converts a UTC instant to wall-clock milliseconds in the local time zone.
+  /// </summary>
+  int64_t ToLocalMilliseconds(int64_t utcMilliseconds) const noexcept {
+    {
+      const auto today = m_today.Read();
+      if (today->uniformOffsetSeconds && utcMilliseconds >= today->localMidnight &&
+          utcMilliseconds < today->nextBoundary) {
+        return utcMilliseconds + *today->uniformOffsetSeconds * 1000;
+      }
+    }
+    return utcMilliseconds + m_clock->UtcOffsetSecondsAt(FloorDiv(utcMilliseconds, 1000)) * 1000;
+  }
+
+  /// <summary>
+  /// Milliseconds elapsed since local midnight for the given UTC instant.
+  /// </summary>
+  int64_t LocalTimeOfDayMilliseconds(int64_t utcMilliseconds) const noexcept {
+    const int64_t localMilliseconds = ToLocalMilliseconds(utcMilliseconds);
+    return localMilliseconds - FloorDiv(localMilliseconds, kMillisecondsPerDay) * kMillisecondsPerDay;
+  }
+
+  /// <summary>
+  /// UTC milliseconds of a wall-clock time today, converted with the offset in effect at that
+  /// time rather than at midnight, so times after a DST transition of the day are not an hour off.
+  /// </summary>
+  int64_t TodayAt(int64_t millisecondsSinceMidnight) const noexcept {
+    const auto today = m_today.Read();
+    const int64_t localMilliseconds = today->localDay * kMillisecondsPerDay + millisecondsSinceMidnight;
+    if (today->uniformOffsetSeconds) {
+      return localMilliseconds - *today->uniformOffsetSeconds * 1000;
+    }
+    const int64_t localSeconds = FloorDiv(localMilliseconds, 1000);
+    return localMilliseconds + (UtcSecondsFromLocal(localSeconds) - localSeconds) * 1000;
+  }
+
+private:
+  // Maps wall-clock seconds to a UTC instant. A time skipped by a DST transition maps past the
+  // transition, so a skipped midnight starts the day at the transition; a repeated time maps
+  // to its first occurrence.
+  int64_t UtcSecondsFromLocal(int64_t localSeconds) const noexcept {
+    const int64_t firstOffset = m_clock->UtcOffsetSecondsAt(localSeconds - m_clock->UtcOffsetSecondsAt(localSeconds));
+    const int64_t firstCandidate = localSeconds - firstOffset;
+    const int64_t secondOffset = m_clock->UtcOffsetSecondsAt(firstCandidate);
+    if (secondOffset == firstOffset) {
+      const int64_t earlierCandidate = localSeconds - m_clock->UtcOffsetSecondsAt(firstCandidate - kSecondsPerDay / 2);
+      if (earlierCandidate < firstCandidate &&
+          m_clock->UtcOffsetSecondsAt(earlierCandidate) == localSeconds - earlierCandidate) {
+        return earlierCandidate;
+      }
+      return firstCandidate;
+    }
+
+    const int64_t secondCandidate = localSeconds - secondOffset;
+    if (m_clock->UtcOffsetSecondsAt(secondCandidate) == secondOffset) {
+      return secondCandidate;
+    }
+    return std::max(firstCandidate, secondCandidate);
+  }
+
+  std::shared_ptr<const IDayAnchorClock> m_clock;
+  SharedCache<AnchoredDay> m_today;
+};
+
+/// <summary>
+/// The system clock with the local time zone rules of the process.
+/// </summary>
+std::shared_ptr<const IDayAnchorClock> SystemClock() noexcept;
+
+/// <summary>
+/// Process-wide anchor backed by the system clock. A thread pool timer refreshes it at
+/// every local day boundary.
+/// </summary>
+DayAnchor &SharedDayAnchor() noexcept;
+
+/// <summary>
+/// Re-reads the local time zone rules and refreshes the shared anchor.
+/// </summary>
+void NotifyTimeZoneChanged() noexcept;
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Schedules a callback for the next UI frame. The XAML implementation hooks
+/// CompositionTarget::Rendering; tests drive frames by hand.
+/// </summary>
+class IFrameScheduler {
+public:
+  virtual ~IFrameScheduler() = default;
+  virtual void RequestFrame(std::function<void()> onFrame) = 0;
+};
+
+/// <summary>
+/// Collects change events from every picker view during one UI frame and delivers them
+/// together. Within a frame only the latest event of each view is kept, marked as having
+/// replaced earlier ones. A batch that reaches
+/// the maximum size is delivered at once, without waiting for the frame.
+/// </summary>
+template <typename TPayload>
+class EventBatcher {
+public:
+  struct Entry {
+    int64_t tag;
+    TPayload payload;
+    bool valuesSkipped{false}; // the payload replaced events queued earlier in the frame
+  };
+
+  using DeliverCallback = std::function<void(std::vector<Entry> &&entries)>;
+
+  static constexpr size_t kDefaultMaxBatchSize = 256;
+
+  EventBatcher(
+      std::shared_ptr<IFrameScheduler> scheduler,
+      DeliverCallback deliver,
+      size_t maxBatchSize = kDefaultMaxBatchSize) noexcept
+      : m_scheduler(std::move(scheduler)), m_deliver(std::move(deliver)), m_maxBatchSize(std::max<size_t>(maxBatchSize, 1)) {}
+
+  /// <summary>
+  /// Queues an event for the next frame, replacing any event already queued for the same view.
+  /// </summary>
+  void Enqueue(int64_t tag, TPayload payload) {
+    bool requestFrame = false;
+    std::vector<Entry> full;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      const auto [existing, inserted] = m_pendingIndex.try_emplace(tag, m_pending.size());
+      if (!inserted) {
+        auto &entry = m_pending[existing->second];
+        entry.payload = std::move(payload);
+        entry.valuesSkipped = true;
+      } else {
+        m_pending.push_back(Entry{tag, std::move(payload)});
+        if (m_pending.size() >= m_maxBatchSize) {
+          // The frame stays requested and delivers whatever is queued after this
+          full.swap(m_pending);
+          m_pendingIndex.clear();
+        }
+      }
+
+      requestFrame = !m_frameRequested;
+      m_frameRequested = true;
+    }
+
+    if (!full.empty()) {
+      m_deliver(std::move(full));
+    }
+    if (requestFrame) {
+      m_scheduler->RequestFrame([this]() { Flush(); });
+    }
+  }
+
+  /// <summary>
+  /// Delivers everything queued so far as one batch. Called by the frame scheduler.
+  /// </summary>
+  void Flush() {
+    std::vector<Entry> entries;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      entries.swap(m_pending);
+      m_pendingIndex.clear();
+      m_frameRequested = false;
+    }
+
+    if (!entries.empty()) {
+      m_deliver(std::move(entries));
+    }
+  }
+
+private:
+  std::shared_ptr<IFrameScheduler> m_scheduler;
+  DeliverCallback m_deliver;
+  const size_t m_maxBatchSize;
+  std::mutex m_mutex;
+  std::vector<Entry> m_pending;
+  std::unordered_map<int64_t, size_t> m_pendingIndex; // position in m_pending by view tag
+  bool m_frameRequested{false};
+};
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Process-wide counters shared by every picker's event queue.
+/// </summary>
+struct EventQueueMetrics {
+  std::atomic<int64_t> pending{0};   // events queued and not yet delivered
+  std::atomic<int64_t> maxDepth{0};  // deepest any single queue has been
+  std::atomic<int64_t> dropped{0};   // intermediate events discarded on overflow
+  std::atomic<int64_t> delivered{0}; // events handed to the dispatcher
+};
+
+inline EventQueueMetrics &SharedEventQueueMetrics() noexcept {
+  static EventQueueMetrics metrics;
+  return metrics;
+}
+
+/// <summary>
+/// Bounded single-producer/single-consumer queue of change events for one picker.
+/// The UI thread pushes, and drains once the JS thread has caught up; producer and consumer
+/// may also be two threads. When the ring is full the queue keeps only the latest event in an
+/// overflow slot and delivers it last, flagged as having skipped values, so a blocked JS thread
+/// sees at most Capacity + 1 events per drain.
+/// </summary>
+template <typename T, size_t Capacity>
+class BoundedEventQueue {
+  static_assert(Capacity >= 2, "Capacity must hold at least two events");
+
+public:
+  explicit BoundedEventQueue(EventQueueMetrics &metrics = SharedEventQueueMetrics()) noexcept : m_metrics(metrics) {}
+
+  ~BoundedEventQueue() {
+    m_metrics.pending.fetch_sub(static_cast<int64_t>(Depth()), std::memory_order_relaxed);
+  }
+
+  /// <summary>
+  /// Producer side. Queues an event.
+  /// </summary>
+  /// <returns>True when no drain is pending and the caller must schedule one</returns>
+  bool Push(T value) {
+    if (!(m_overflowActive.load(std::memory_order_acquire) && TryReplaceOverflow(value))) {
+      const size_t tail = m_tail.load(std::memory_order_relaxed);
+      const size_t head = m_head.load(std::memory_order_acquire);
+      if (tail - head < Capacity) {
+        m_buffer[tail % Capacity] = std::move(value);
+        m_tail.store(tail + 1, std::memory_order_release);
+        AddPending(tail + 1 - head);
+      } else {
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        m_overflow = std::move(value);
+        m_overflowActive.store(true, std::memory_order_release);
+        AddPending(Capacity + 1);
+      }
+    }
+
+    return !m_drainScheduled.exchange(true, std::memory_order_acq_rel);
+  }
+
+  /// <summary>
+  /// Consumer side. Delivers queued events in order as deliver(T &&event, bool valuesSkipped).
+  /// </summary>
+  /// <returns>Number of events delivered</returns>
+  template <typename TDeliver>
+  size_t Drain(TDeliver &&deliver) {
+    size_t deliveredCount = 0;
+    for (;;) {
+      size_t head = m_head.load(std::memory_order_relaxed);
+      const size_t tail = m_tail.load(std::memory_order_acquire);
+      while (head != tail) {
+        T value = std::move(m_buffer[head % Capacity]);
+        m_head.store(++head, std::memory_order_release);
+        Delivered();
+        deliver(std::move(value), false);
+        ++deliveredCount;
+      }
+
+      // The overflow event is newer than anything in the ring, so it is only taken once the ring is empty
+      std::optional<T> overflow;
+      uint64_t skipped = 0;
+      {
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        if (m_overflowActive.load(std::memory_order_relaxed) && RingEmpty()) {
+          overflow = std::move(m_overflow);
+          skipped = m_overflowSkipped;
+          m_overflow.reset();
+          m_overflowSkipped = 0;
+          m_overflowActive.store(false, std::memory_order_release);
+        }
+      }
+      if (overflow) {
+        Delivered();
+        deliver(std::move(*overflow), skipped > 0);
+        ++deliveredCount;
+      }
+
+      m_drainScheduled.store(false, std::memory_order_seq_cst);
+      if (Empty() || m_drainScheduled.exchange(true, std::memory_order_acq_rel)) {
+        return deliveredCount;
+      }
+    }
+  }
+
+  size_t Depth() const noexcept {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire) +
+        (m_overflowActive.load(std::memory_order_acquire) ? 1 : 0);
+  }
+
+  uint64_t Dropped() const noexcept {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+private:
+  bool RingEmpty() const noexcept {
+    return m_tail.load(std::memory_order_acquire) == m_head.load(std::memory_order_acquire);
+  }
+
+  bool Empty() const noexcept {
+    return RingEmpty() && !m_overflowActive.load(std::memory_order_acquire);
+  }
+
+  bool TryReplaceOverflow(T &value) {
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    if (!m_overflowActive.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    m_overflow = std::move(value);
+    ++m_overflowSkipped;
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+    m_metrics.dropped.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  void AddPending(size_t depth) noexcept {
+    m_metrics.pending.fetch_add(1, std::memory_order_relaxed);
+    int64_t maxDepth = m_metrics.maxDepth.load(std::memory_order_relaxed);
+    while (static_cast<int64_t>(depth) > maxDepth &&
+           !m_metrics.maxDepth.compare_exchange_weak(maxDepth, static_cast<int64_t>(depth), std::memory_order_relaxed)) {
+    }
+  }
+
+  void Delivered() noexcept {
+    m_metrics.pending.fetch_sub(1, std::memory_order_relaxed);
+    m_metrics.delivered.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  EventQueueMetrics &m_metrics;
+  std::array<T, Capacity> m_buffer{};
+  std::atomic<size_t> m_head{0};
+  std::atomic<size_t> m_tail{0};
+  std::atomic<bool> m_drainScheduled{false};
+  std::atomic<uint64_t> m_dropped{0};
+
+  std::mutex m_overflowMutex;
+  std::atomic<bool> m_overflowActive{false};
+  std::optional<T> m_overflow;
+  uint64_t m_overflowSkipped{0};
+};
+
+/// <summary>
+/// Queue used by every picker view: a handful of events absorbs normal bursts, anything beyond
+/// collapses into the latest value.
+/// </summary>
+template <typename T>
+using PickerEventQueue = BoundedEventQueue<T, 8>;
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// In-memory implementations of the interfaces in PickerControls.h. They record what the
+// picker logic sets, so it can be exercised and profiled without XAML.
+
+#include "PickerControls.h"
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Props held in a map, visited in name order like a JSValueObject.
+/// </summary>
+class MapPropReader final : public IPickerPropReader {
+public:
+  MapPropReader() = default;
+  MapPropReader(std::map<std::string, PickerPropValue, std::less<>> props) : m_props(std::move(props)) {}
+
+  void Set(std::string name, PickerPropValue value) {
+    m_props[std::move(name)] = std::move(value);
+  }
+
+  void ForEach(const Visitor &visitor) const override {
+    for (const auto &[name, value] : m_props) {
+      visitor(name, value);
+    }
+  }
+
+private:
+  std::map<std::string, PickerPropValue, std::less<>> m_props;
+};
+
+/// <summary>
+/// Date control that keeps its properties in fields. Picking a date is simulated by passing
+/// the new value to DatePickerLogic::OnDateChanged.
+/// </summary>
+class HeadlessDateControl final : public IDateControl {
+public:
+  void Date(std::optional<int64_t> wallSeconds) override {
+    date = wallSeconds;
+    ++setterCalls;
+  }
+
+  void MinDate(std::optional<int64_t> wallSeconds) override {
+    minDate = wallSeconds;
+    ++setterCalls;
+  }
+
+  void MaxDate(std::optional<int64_t> wallSeconds) override {
+    maxDate = wallSeconds;
+    ++setterCalls;
+  }
+
+  void DateFormat(const std::optional<PickerText> &format) override {
+    dateFormat = format;
+    ++setterCalls;
+  }
+
+  void DayOfWeekFormat(const std::optional<PickerText> &format) override {
+    dayOfWeekFormat = format;
+    ++setterCalls;
+  }
+
+  void FirstDayOfWeek(std::optional<int32_t> dayOfWeek) override {
+    firstDayOfWeek = dayOfWeek;
+    ++setterCalls;
+  }
+
+  void PlaceholderText(const std::optional<PickerText> &text) override {
+    placeholderText = text;
+    ++setterCalls;
+  }
+
+  void Name(const PickerText &value) override {
+    name = value;
+    ++setterCalls;
+  }
+
+  std::optional<int64_t> date, minDate, maxDate;
+  std::optional<PickerText> dateFormat, dayOfWeekFormat, placeholderText;
+  std::optional<int32_t> firstDayOfWeek;
+  PickerText name;
+  int64_t setterCalls{0};
+};
+
+/// <summary>
+/// Time control that keeps its properties in fields.
+/// </summary>
+class HeadlessTimeControl final : public ITimeControl {
+public:
+  void Time(std::optional<int64_t> millisecondsSinceMidnight) override {
+    time = millisecondsSinceMidnight;
+    ++setterCalls;
+  }
+
+  void Is24Hour(std::optional<bool> value) override {
+    is24Hour = value;
+    ++setterCalls;
+  }
+
+  void MinuteIncrement(std::optional<int32_t> value) override {
+    minuteIncrement = value;
+    ++setterCalls;
+  }
+
+  std::optional<int64_t> time;
+  std::optional<bool> is24Hour;
+  std::optional<int32_t> minuteIncrement;
+  int64_t setterCalls{0};
+};
+
+/// <summary>
+/// Event emitter that records every change in order.
+/// </summary>
+class RecordingEventEmitter final : public IPickerEventEmitter {
+public:
+  void EmitChange(int64_t timeInMilliseconds) override {
+    changes.push_back(timeInMilliseconds);
+  }
+
+  std::vector<int64_t> changes;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
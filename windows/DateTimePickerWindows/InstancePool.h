@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Counters for one kind of pooled instance, summed over every thread's pool.
+/// </summary>
+struct InstancePoolMetrics {
+  std::atomic<int64_t> hits{0};      // acquisitions served from a pool
+  std::atomic<int64_t> misses{0};    // acquisitions that had to create an instance
+  std::atomic<int64_t> returned{0};  // instances reset and kept for reuse
+  std::atomic<int64_t> discarded{0}; // instances dropped because the pool was full or the reset failed
+  std::atomic<int64_t> warmed{0};    // instances created ahead of time by warm-up
+};
+
+/// <summary>
+/// Bounded pool of reusable instances owned by a single thread. Controls hosted in XAML islands
+/// are bound to the thread that created them, so each UI thread keeps its own pool and none of
+/// the operations are synchronized; only the shared metrics are atomic.
+/// </summary>
+template <typename T>
+class InstancePool {
+public:
+  using Factory = std::function<T()>;
+  using Reset = std::function<bool(T &)>;
+
+  InstancePool(size_t capacity, Factory factory, Reset reset, InstancePoolMetrics &metrics) noexcept
+      : m_capacity(capacity), m_factory(std::move(factory)), m_reset(std::move(reset)), m_metrics(metrics) {}
+
+  /// <summary>
+  /// Takes a pooled instance, or creates one when the pool is empty.
+  /// </summary>
+  T Acquire() {
+    if (!m_items.empty()) {
+      T item = std::move(m_items.back());
+      m_items.pop_back();
+      m_metrics.hits.fetch_add(1, std::memory_order_relaxed);
+      return item;
+    }
+
+    m_metrics.misses.fetch_add(1, std::memory_order_relaxed);
+    return m_factory();
+  }
+
+  /// <summary>
+  /// Resets an instance and keeps it for the next Acquire().
+  /// </summary>
+  /// <returns>False when the instance was dropped instead</returns>
+  bool Release(T item) {
+    if (m_items.size() >= m_capacity || !m_reset(item)) {
+      m_metrics.discarded.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    m_items.push_back(std::move(item));
+    m_metrics.returned.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// <summary>
+  /// Creates one instance ahead of time if the pool is below its target size. Called repeatedly
+  /// from idle callbacks so warm-up never blocks a frame for long.
+  /// </summary>
+  /// <returns>True while more warm-up steps are needed</returns>
+  bool WarmStep() {
+    if (m_items.size() >= WarmTarget()) {
+      return false;
+    }
+
+    m_items.push_back(m_factory());
+    m_metrics.warmed.fetch_add(1, std::memory_order_relaxed);
+    return m_items.size() < WarmTarget();
+  }
+
+  /// <summary>
+  /// Number of instances warm-up fills the pool to. Never more than the capacity.
+  /// </summary>
+  size_t WarmTarget() const noexcept {
+    return std::min(m_warmTarget, m_capacity);
+  }
+
+  void WarmTarget(size_t target) noexcept {
+    m_warmTarget = target;
+  }
+
+  size_t Size() const noexcept {
+    return m_items.size();
+  }
+
+  size_t Capacity() const noexcept {
+    return m_capacity;
+  }
+
+  void Clear() noexcept {
+    m_items.clear();
+  }
+
+  /// <summary>
+  /// Empties the pool without destroying the instances, for owners that must dispose of them some other way.
+  /// </summary>
+  std::vector<T> TakeAll() noexcept {
+    return std::exchange(m_items, {});
+  }
+
+private:
+  size_t m_capacity;
+  size_t m_warmTarget{0};
+  Factory m_factory;
+  Reset m_reset;
+  InstancePoolMetrics &m_metrics;
+  std::vector<T> m_items;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Counters of the refresh batches run by one LivePickerViews.
+/// </summary>
+struct LivePickerViewsStats {
+  int64_t batches{0};       // RefreshAll() calls
+  int64_t viewsUpdated{0};  // views refreshed, summed over all batches
+  int64_t viewsReleased{0}; // registrations found dead and dropped
+  int64_t lastBatchViews{0};
+  double lastBatchMilliseconds{0};
+  double maxBatchMilliseconds{0};
+};
+
+/// <summary>
+/// The mounted pickers of one window, so state that does not come from props, such as the
+/// local time zone and the user's languages, can be re-applied to all of them at once
+/// without a round trip through JS.
+///
+/// Views register a refresh callback that holds only a weak reference to the view and returns
+/// false once the view is gone; such entries are dropped on the next batch. RefreshAll() runs
+/// the callbacks without holding the lock, so a callback may register or remove views.
+/// </summary>
+class LivePickerViews {
+public:
+  using ViewId = uint64_t;
+  using Refresh = std::function<bool()>;
+
+  LivePickerViews() = default;
+  LivePickerViews(const LivePickerViews &) = delete;
+  LivePickerViews &operator=(const LivePickerViews &) = delete;
+
+  ViewId Add(Refresh refresh) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const ViewId id = m_nextId++;
+    m_views.push_back(Entry{id, std::move(refresh)});
+    return id;
+  }
+
+  void Remove(ViewId id) noexcept {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    const auto entry = std::find_if(m_views.begin(), m_views.end(), [id](const Entry &item) { return item.id == id; });
+    if (entry != m_views.end()) {
+      m_views.erase(entry);
+    }
+  }
+
+  size_t Count() const noexcept {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_views.size();
+  }
+
+  /// <summary>
+  /// Runs every view's refresh callback, on the thread that owns the views.
+  /// </summary>
+  /// <returns>The number of views refreshed</returns>
+  size_t RefreshAll() {
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<Entry> views;
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      views = m_views;
+    }
+
+    size_t updated = 0;
+    std::vector<ViewId> released;
+    for (const auto &view : views) {
+      if (view.refresh()) {
+        ++updated;
+      } else {
+        released.push_back(view.id);
+      }
+    }
+
+    const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_views.erase(
+        std::remove_if(
+            m_views.begin(),
+            m_views.end(),
+            [&released](const Entry &entry) {
+              return std::find(released.begin(), released.end(), entry.id) != released.end();
+            }),
+        m_views.end());
+
+    ++m_stats.batches;
+    m_stats.viewsUpdated += static_cast<int64_t>(updated);
+    m_stats.viewsReleased += static_cast<int64_t>(released.size());
+    m_stats.lastBatchViews = static_cast<int64_t>(updated);
+    m_stats.lastBatchMilliseconds = elapsed;
+    m_stats.maxBatchMilliseconds = std::max(m_stats.maxBatchMilliseconds, elapsed);
+    return updated;
+  }
+
+  LivePickerViewsStats Stats() const noexcept {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_stats;
+  }
+
+private:
+  struct Entry {
+    ViewId id;
+    Refresh refresh;
+  };
+
+  mutable std::mutex m_mutex;
+  ViewId m_nextId{1};
+  std::vector<Entry> m_views;
+  LivePickerViewsStats m_stats;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -33,6 +33,15 @@ struct DatePickerModuleWindowsSpec_DatePickerOpenParams {
 
   REACT_FIELD(timeZoneOffsetInSeconds)
   std::optional<double> timeZoneOffsetInSeconds;
+
+  REACT_FIELD(includeFields)
+  std::optional<bool> includeFields;
+
+  REACT_FIELD(timeoutMs)
+  std::optional<double> timeoutMs;
+
+  REACT_FIELD(sessionId)
+  std::optional<double> sessionId;
 };
 
 REACT_STRUCT(DatePickerModuleWindowsSpec_DatePickerResult)
@@ -45,13 +54,34 @@ struct DatePickerModuleWindowsSpec_DatePickerResult {
 
   REACT_FIELD(utcOffset)
   int32_t utcOffset;
+
+  REACT_FIELD(year)
+  std::optional<int32_t> year;
+
+  REACT_FIELD(month)
+  std::optional<int32_t> month;
+
+  REACT_FIELD(day)
+  std::optional<int32_t> day;
+
+  REACT_FIELD(weekday)
+  std::optional<int32_t> weekday;
+
+  REACT_FIELD(dayOfYear)
+  std::optional<int32_t> dayOfYear;
+
+  REACT_FIELD(isoWeek)
+  std::optional<int32_t> isoWeek;
+
+  REACT_FIELD(sessionId)
+  double sessionId;
 };
 
 REACT_MODULE(DatePickerModuleWindows)
 struct DatePickerModuleWindowsSpec : winrt::Microsoft::ReactNative::TurboModuleSpec {
   static constexpr auto methods = std::tuple{
       Method<DatePickerModuleWindowsSpec_DatePickerResult(DatePickerModuleWindowsSpec_DatePickerOpenParams) noexcept>{0, L"open"},
-      Method<bool() noexcept>{1, L"dismiss"},
+      Method<bool(std::optional<double>) noexcept>{1, L"dismiss"},
   };
 
   template <class TModule>
@@ -68,7 +98,7 @@ struct DatePickerModuleWindowsSpec : winrt::Microsoft::ReactNative::TurboModuleS
         1,
         "dismiss",
         "    REACT_METHOD(Dismiss, L\"dismiss\")\n"
-        "    void Dismiss(ReactPromise<bool> promise) noexcept;\n");
+        "    void Dismiss(std::optional<double> sessionId, ReactPromise<bool> promise) noexcept;\n");
   }
 };
 
@@ -86,6 +116,15 @@ struct TimePickerModuleWindowsSpec_TimePickerOpenParams {
 
   REACT_FIELD(testID)
   std::optional<std::string> testID;
+
+  REACT_FIELD(includeFields)
+  std::optional<bool> includeFields;
+
+  REACT_FIELD(timeoutMs)
+  std::optional<double> timeoutMs;
+
+  REACT_FIELD(sessionId)
+  std::optional<double> sessionId;
 };
 
 REACT_STRUCT(TimePickerModuleWindowsSpec_TimePickerResult)
@@ -98,13 +137,34 @@ struct TimePickerModuleWindowsSpec_TimePickerResult {
 
   REACT_FIELD(minute)
   int32_t minute;
+
+  REACT_FIELD(year)
+  std::optional<int32_t> year;
+
+  REACT_FIELD(month)
+  std::optional<int32_t> month;
+
+  REACT_FIELD(day)
+  std::optional<int32_t> day;
+
+  REACT_FIELD(weekday)
+  std::optional<int32_t> weekday;
+
+  REACT_FIELD(dayOfYear)
+  std::optional<int32_t> dayOfYear;
+
+  REACT_FIELD(isoWeek)
+  std::optional<int32_t> isoWeek;
+
+  REACT_FIELD(sessionId)
+  double sessionId;
 };
 
 REACT_MODULE(TimePickerModuleWindows)
 struct TimePickerModuleWindowsSpec : winrt::Microsoft::ReactNative::TurboModuleSpec {
   static constexpr auto methods = std::tuple{
       Method<TimePickerModuleWindowsSpec_TimePickerResult(TimePickerModuleWindowsSpec_TimePickerOpenParams) noexcept>{0, L"open"},
-      Method<bool() noexcept>{1, L"dismiss"},
+      Method<bool(std::optional<double>) noexcept>{1, L"dismiss"},
   };
 
   template <class TModule>
@@ -121,7 +181,54 @@ struct TimePickerModuleWindowsSpec : winrt::Microsoft::ReactNative::TurboModuleS
         1,
         "dismiss",
         "    REACT_METHOD(Dismiss, L\"dismiss\")\n"
-        "    void Dismiss(ReactPromise<bool> promise) noexcept;\n");
+        "    void Dismiss(std::optional<double> sessionId, ReactPromise<bool> promise) noexcept;\n");
+  }
+};
+
+// PickerDateMath TurboModule Specs
+REACT_MODULE(PickerDateMathModuleWindows)
+struct PickerDateMathModuleWindowsSpec : winrt::Microsoft::ReactNative::TurboModuleSpec {
+  static constexpr auto methods = std::tuple{
+      SyncMethod<std::vector<double>(std::vector<double>, double, double, double, std::optional<double>) noexcept>{0, L"addCalendarUnits"},
+      SyncMethod<std::vector<double>(std::vector<double>, double, std::vector<double>, std::optional<double>) noexcept>{1, L"addBusinessDays"},
+      SyncMethod<std::vector<double>(double, double, std::vector<double>, std::optional<double>) noexcept>{2, L"nextBusinessDays"},
+      SyncMethod<std::vector<double>(std::vector<double>, std::optional<double>, std::optional<double>) noexcept>{3, L"clampDates"},
+      SyncMethod<std::vector<double>(std::vector<double>, std::vector<double>) noexcept>{4, L"intersectDateRanges"},
+  };
+
+  template <class TModule>
+  static constexpr void ValidateModule() noexcept {
+    constexpr auto methodCheckResults = CheckMethods<TModule, PickerDateMathModuleWindowsSpec>();
+
+    REACT_SHOW_SYNC_METHOD_SPEC_ERRORS(
+        0,
+        "addCalendarUnits",
+        "    REACT_SYNC_METHOD(AddCalendarUnits, L\"addCalendarUnits\")\n"
+        "    std::vector<double> AddCalendarUnits(std::vector<double> dates, double years, double months, double days, std::optional<double> timeZoneOffsetInSeconds) noexcept;\n");
+
+    REACT_SHOW_SYNC_METHOD_SPEC_ERRORS(
+        1,
+        "addBusinessDays",
+        "    REACT_SYNC_METHOD(AddBusinessDays, L\"addBusinessDays\")\n"
+        "    std::vector<double> AddBusinessDays(std::vector<double> dates, double count, std::vector<double> holidays, std::optional<double> timeZoneOffsetInSeconds) noexcept;\n");
+
+    REACT_SHOW_SYNC_METHOD_SPEC_ERRORS(
+        2,
+        "nextBusinessDays",
+        "    REACT_SYNC_METHOD(NextBusinessDays, L\"nextBusinessDays\")\n"
+        "    std::vector<double> NextBusinessDays(double start, double count, std::vector<double> holidays, std::optional<double> timeZoneOffsetInSeconds) noexcept;\n");
+
+    REACT_SHOW_SYNC_METHOD_SPEC_ERRORS(
+        3,
+        "clampDates",
+        "    REACT_SYNC_METHOD(ClampDates, L\"clampDates\")\n"
+        "    std::vector<double> ClampDates(std::vector<double> dates, std::optional<double> minimumDate, std::optional<double> maximumDate) noexcept;\n");
+
+    REACT_SHOW_SYNC_METHOD_SPEC_ERRORS(
+        4,
+        "intersectDateRanges",
+        "    REACT_SYNC_METHOD(IntersectDateRanges, L\"intersectDateRanges\")\n"
+        "    std::vector<double> IntersectDateRanges(std::vector<double> first, std::vector<double> second) noexcept;\n");
   }
 };
 
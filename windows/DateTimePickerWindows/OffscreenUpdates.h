@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Process-wide counters of prop updates held back while views were offscreen.
+/// </summary>
+struct OffscreenUpdateStats {
+  std::atomic<int64_t> suspended{0}; // views that went offscreen
+  std::atomic<int64_t> resumed{0};   // views that came back
+  std::atomic<int64_t> deferred{0};  // prop updates received while offscreen
+  std::atomic<int64_t> collapsed{0}; // deferred updates merged into a later one, never applied on their own
+  std::atomic<int64_t> flushed{0};   // pending updates applied when a view came back
+};
+
+inline OffscreenUpdateStats &SharedOffscreenStats() noexcept {
+  static OffscreenUpdateStats stats;
+  return stats;
+}
+
+/// <summary>
+/// Whether a view is offscreen, and the prop update it has not applied yet because of it.
+/// A view is offscreen while its layout has no area (collapsed sections, display: none) or
+/// its island is not visible (inactive tabs, minimized windows). Updates received meanwhile
+/// are merged into one, which is applied when the view comes back. Used on the UI thread only.
+/// </summary>
+template <typename TUpdate>
+class OffscreenUpdates {
+public:
+  enum class Transition {
+    None,
+    Hidden, // detach event handlers
+    Shown,  // apply TakePending(), then attach event handlers
+  };
+
+  explicit OffscreenUpdates(OffscreenUpdateStats &stats = SharedOffscreenStats()) noexcept : m_stats(stats) {}
+
+  bool IsOffscreen() const noexcept {
+    return m_layoutEmpty || !m_siteVisible;
+  }
+
+  Transition SetLayoutSize(float width, float height) noexcept {
+    return Update([&] { m_layoutEmpty = !(width > 0 && height > 0); });
+  }
+
+  Transition SetSiteVisible(bool visible) noexcept {
+    return Update([&] { m_siteVisible = visible; });
+  }
+
+  /// <summary>
+  /// Holds back an update. A pending one absorbs it through merge(pending, update).
+  /// </summary>
+  template <typename TMerge>
+  void Defer(TUpdate update, TMerge &&merge) {
+    m_stats.deferred.fetch_add(1, std::memory_order_relaxed);
+    if (m_pending) {
+      merge(*m_pending, std::move(update));
+      m_stats.collapsed.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      m_pending = std::move(update);
+    }
+  }
+
+  /// <summary>
+  /// The merged update to apply now that the view is back, if any.
+  /// </summary>
+  std::optional<TUpdate> TakePending() noexcept {
+    std::optional<TUpdate> pending;
+    if (m_pending) {
+      m_stats.flushed.fetch_add(1, std::memory_order_relaxed);
+      pending.swap(m_pending);
+    }
+    return pending;
+  }
+
+  /// <summary>
+  /// Forgets the pending update, for views that applied their full props by other means.
+  /// </summary>
+  void DropPending() noexcept {
+    m_pending.reset();
+  }
+
+private:
+  template <typename TChange>
+  Transition Update(TChange &&change) noexcept {
+    const bool wasOffscreen = IsOffscreen();
+    change();
+    if (wasOffscreen == IsOffscreen()) {
+      return Transition::None;
+    }
+
+    if (wasOffscreen) {
+      m_stats.resumed.fetch_add(1, std::memory_order_relaxed);
+      return Transition::Shown;
+    }
+    m_stats.suspended.fetch_add(1, std::memory_order_relaxed);
+    return Transition::Hidden;
+  }
+
+  OffscreenUpdateStats &m_stats;
+  bool m_layoutEmpty{false}; // no layout yet counts as visible, so the first props apply at once
+  bool m_siteVisible{true};
+  std::optional<TUpdate> m_pending;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Immutable results of preparing a prop update. Building a plan does every conversion
+// (time zone offsets, day anchoring, control strings) and can run on any thread; applying
+// it on the UI thread only calls control setters. Header-only.
+
+#include "PickerControls.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// A control property touched by an update. When changed and empty, the property is restored
+/// to its default.
+/// </summary>
+template <typename T>
+struct PlannedValue {
+  bool changed{false};
+  std::optional<T> value;
+
+  void Set(T newValue) {
+    changed = true;
+    value = std::move(newValue);
+  }
+
+  void Clear() noexcept {
+    changed = true;
+    value.reset();
+  }
+};
+
+/// <summary>
+/// Setters for one CalendarDatePicker update. Dates are wall-clock seconds with the time zone
+/// offset applied.
+/// </summary>
+struct DateApplyPlan {
+  PlannedValue<PickerText> dayOfWeekFormat;
+  PlannedValue<PickerText> dateFormat;
+  PlannedValue<int32_t> firstDayOfWeek;
+  PlannedValue<PickerText> placeholderText;
+  PlannedValue<PickerText> name;
+  PlannedValue<int64_t> maxDate;
+  PlannedValue<int64_t> minDate;
+  PlannedValue<int64_t> date;
+  int64_t timeZoneOffsetInSeconds{0}; // Used to convert dates picked after the plan is applied
+};
+
+/// <summary>
+/// Setters for one TimePicker update.
+/// </summary>
+struct TimeApplyPlan {
+  PlannedValue<bool> is24Hour;
+  PlannedValue<int32_t> minuteIncrement;
+  PlannedValue<int64_t> time; // milliseconds since midnight
+};
+
+/// <summary>
+/// Process-wide counters of plan building and UI-thread apply time.
+/// </summary>
+struct PickerApplyStats {
+  std::atomic<int64_t> plans{0};
+  std::atomic<int64_t> applies{0};
+  std::atomic<int64_t> applyNanoseconds{0};
+  std::atomic<int64_t> maxApplyNanoseconds{0};
+
+  void RecordApply(int64_t nanoseconds) noexcept {
+    applies.fetch_add(1, std::memory_order_relaxed);
+    applyNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    int64_t previous = maxApplyNanoseconds.load(std::memory_order_relaxed);
+    while (previous < nanoseconds &&
+           !maxApplyNanoseconds.compare_exchange_weak(previous, nanoseconds, std::memory_order_relaxed)) {
+    }
+  }
+};
+
+inline PickerApplyStats &SharedApplyStats() noexcept {
+  static PickerApplyStats stats;
+  return stats;
+}
+
+/// <summary>
+/// Records the time from construction to destruction as one apply.
+/// </summary>
+class ScopedApplyTimer {
+public:
+  explicit ScopedApplyTimer(PickerApplyStats &stats = SharedApplyStats()) noexcept
+      : m_stats(stats), m_start(std::chrono::steady_clock::now()) {}
+
+  ~ScopedApplyTimer() {
+    const auto elapsed = std::chrono::steady_clock::now() - m_start;
+    m_stats.RecordApply(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+  ScopedApplyTimer(const ScopedApplyTimer &) = delete;
+  ScopedApplyTimer &operator=(const ScopedApplyTimer &) = delete;
+
+private:
+  PickerApplyStats &m_stats;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+/// <summary>
+/// Runs the setter when the planned value changed, passing an empty optional to restore the default.
+/// </summary>
+template <typename T, typename TSetter>
+void ApplyPlannedValue(const PlannedValue<T> &planned, TSetter &&setter) {
+  if (planned.changed) {
+    setter(planned.value);
+  }
+}
+
+/// <summary>
+/// Executes a date plan. Performs no conversions, so it is the only work left for the UI thread.
+/// </summary>
+inline void ApplyPlan(const DateApplyPlan &plan, IDateControl &control) {
+  ApplyPlannedValue(plan.dayOfWeekFormat, [&](const auto &value) { control.DayOfWeekFormat(value); });
+  ApplyPlannedValue(plan.dateFormat, [&](const auto &value) { control.DateFormat(value); });
+  ApplyPlannedValue(plan.firstDayOfWeek, [&](const auto &value) { control.FirstDayOfWeek(value); });
+  ApplyPlannedValue(plan.placeholderText, [&](const auto &value) { control.PlaceholderText(value); });
+  if (plan.name.changed && plan.name.value) {
+    control.Name(*plan.name.value);
+  }
+
+  // The range goes first so the control does not coerce the new date into the old range
+  ApplyPlannedValue(plan.maxDate, [&](const auto &value) { control.MaxDate(value); });
+  ApplyPlannedValue(plan.minDate, [&](const auto &value) { control.MinDate(value); });
+  ApplyPlannedValue(plan.date, [&](const auto &value) { control.Date(value); });
+}
+
+/// <summary>
+/// Executes a time plan.
+/// </summary>
+inline void ApplyPlan(const TimeApplyPlan &plan, ITimeControl &control) {
+  ApplyPlannedValue(plan.is24Hour, [&](const auto &value) { control.Is24Hour(value); });
+  ApplyPlannedValue(plan.minuteIncrement, [&](const auto &value) { control.MinuteIncrement(value); });
+  ApplyPlannedValue(plan.time, [&](const auto &value) { control.Time(value); });
+}
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Small interfaces between the picker logic and the platform controls. They are header-only
+// and only use WinRT for strings where it is available, so the prop and event logic in
+// PickerLogic.h can run against the XAML adapters (XamlPickerControls.h) or the in-memory
+// controls (HeadlessControls.h).
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#if __has_include(<winrt/base.h>)
+#include <winrt/base.h>
+#endif
+
+namespace winrt::DateTimePicker::Helpers {
+
+#if __has_include(<winrt/base.h>)
+/// <summary>
+/// Text set on a control. An hstring, so plans hand it to XAML without another copy.
+/// </summary>
+using PickerText = winrt::hstring;
+
+inline PickerText PickerTextFromUtf8(std::string_view text) {
+  return winrt::to_hstring(text);
+}
+#else
+// Headless builds keep the UTF-8 text as received
+using PickerText = std::string;
+
+inline PickerText PickerTextFromUtf8(std::string_view text) {
+  return PickerText{text};
+}
+#endif
+
+/// <summary>
+/// A single prop value as received from JavaScript. Objects and arrays are not used by the
+/// pickers and are read as null.
+/// </summary>
+class PickerPropValue {
+public:
+  PickerPropValue() noexcept = default;
+  PickerPropValue(std::nullptr_t) noexcept {}
+  PickerPropValue(bool value) noexcept : m_value(value) {}
+  PickerPropValue(int32_t value) noexcept : m_value(static_cast<int64_t>(value)) {}
+  PickerPropValue(int64_t value) noexcept : m_value(value) {}
+  PickerPropValue(double value) noexcept : m_value(value) {}
+  PickerPropValue(std::string value) noexcept : m_value(std::move(value)) {}
+  PickerPropValue(const char *value) : m_value(std::string{value}) {}
+
+  bool IsNull() const noexcept {
+    return std::holds_alternative<std::monostate>(m_value);
+  }
+
+  /// <summary>
+  /// Numeric value; doubles are truncated and booleans read as 0 or 1, as JSValue does.
+  /// </summary>
+  int64_t AsInt64() const noexcept {
+    if (auto value = std::get_if<int64_t>(&m_value)) {
+      return *value;
+    }
+    if (auto value = std::get_if<double>(&m_value)) {
+      return static_cast<int64_t>(*value);
+    }
+    if (auto value = std::get_if<bool>(&m_value)) {
+      return *value ? 1 : 0;
+    }
+    return 0;
+  }
+
+  /// <summary>
+  /// JavaScript truthiness of the value.
+  /// </summary>
+  bool AsBoolean() const noexcept {
+    if (auto value = std::get_if<bool>(&m_value)) {
+      return *value;
+    }
+    if (auto value = std::get_if<int64_t>(&m_value)) {
+      return *value != 0;
+    }
+    if (auto value = std::get_if<double>(&m_value)) {
+      return *value != 0 && *value == *value;
+    }
+    if (auto value = std::get_if<std::string>(&m_value)) {
+      return !value->empty();
+    }
+    return false;
+  }
+
+  /// <summary>
+  /// String value; empty for anything that is not a string.
+  /// </summary>
+  std::string_view AsString() const noexcept {
+    if (auto value = std::get_if<std::string>(&m_value)) {
+      return *value;
+    }
+    return {};
+  }
+
+private:
+  std::variant<std::monostate, bool, int64_t, double, std::string> m_value;
+};
+
+/// <summary>
+/// Source of the props changed by one update.
+/// </summary>
+class IPickerPropReader {
+public:
+  using Visitor = std::function<void(std::string_view name, const PickerPropValue &value)>;
+
+  virtual ~IPickerPropReader() = default;
+
+  /// <summary>
+  /// Calls the visitor once for every prop in the update.
+  /// </summary>
+  virtual void ForEach(const Visitor &visitor) const = 0;
+};
+
+/// <summary>
+/// Setters of a calendar date picker. An empty optional restores the control's default.
+/// Dates are wall-clock seconds since the Unix epoch, with the picker's time zone offset applied.
+/// </summary>
+class IDateControl {
+public:
+  virtual ~IDateControl() = default;
+
+  virtual void Date(std::optional<int64_t> wallSeconds) = 0;
+  virtual void MinDate(std::optional<int64_t> wallSeconds) = 0;
+  virtual void MaxDate(std::optional<int64_t> wallSeconds) = 0;
+  virtual void DateFormat(const std::optional<PickerText> &format) = 0;
+  virtual void DayOfWeekFormat(const std::optional<PickerText> &format) = 0;
+  virtual void FirstDayOfWeek(std::optional<int32_t> dayOfWeek) = 0;
+  virtual void PlaceholderText(const std::optional<PickerText> &text) = 0;
+  virtual void Name(const PickerText &name) = 0;
+};
+
+/// <summary>
+/// Setters of a time picker. An empty optional restores the control's default.
+/// </summary>
+class ITimeControl {
+public:
+  virtual ~ITimeControl() = default;
+
+  virtual void Time(std::optional<int64_t> millisecondsSinceMidnight) = 0;
+  virtual void Is24Hour(std::optional<bool> is24Hour) = 0;
+  virtual void MinuteIncrement(std::optional<int32_t> minuteIncrement) = 0;
+};
+
+/// <summary>
+/// Receives the change events produced by the picker logic.
+/// </summary>
+class IPickerEventEmitter {
+public:
+  virtual ~IPickerEventEmitter() = default;
+
+  /// <summary>
+  /// Reports a new value, in milliseconds since the Unix epoch.
+  /// </summary>
+  virtual void EmitChange(int64_t timeInMilliseconds) = 0;
+};
+
+/// <summary>
+/// Event emitter that forwards to a callable, for views that queue or batch their events.
+/// </summary>
+class CallbackEventEmitter final : public IPickerEventEmitter {
+public:
+  explicit CallbackEventEmitter(std::function<void(int64_t)> callback) noexcept : m_callback(std::move(callback)) {}
+
+  void EmitChange(int64_t timeInMilliseconds) override {
+    m_callback(timeInMilliseconds);
+  }
+
+private:
+  std::function<void(int64_t)> m_callback;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,196 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PickerDateMathJsi.h"
+#include "DateMath.h"
+#include "PickerTypedArrays.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace winrt::DateTimePicker {
+
+namespace {
+
+using facebook::jsi::Runtime;
+using facebook::jsi::Value;
+
+// Longest list nextBusinessDays() returns, as in PickerDateMathModule
+constexpr double kMaxBusinessDayList = 1 << 20;
+
+double NumberAt(const Value *args, size_t count, size_t index) {
+  return index < count && args[index].isNumber() ? args[index].asNumber() : 0;
+}
+
+std::optional<double> OptionalNumberAt(const Value *args, size_t count, size_t index) {
+  if (index < count && args[index].isNumber()) {
+    return args[index].asNumber();
+  }
+  return std::nullopt;
+}
+
+void FillInvalid(TimestampArray &dates) noexcept {
+  std::visit(
+      [](auto elements) {
+        for (auto &element : elements) {
+          Helpers::StoreTimestamp(element, std::nullopt);
+        }
+      },
+      dates);
+}
+
+// Holidays from a typed array, read in place, or from a plain array of numbers
+Helpers::BusinessCalendar CalendarFrom(Runtime &runtime, const Value *args, size_t count, size_t index, Helpers::ZoneOffsets &zone) {
+  if (index >= count) {
+    return Helpers::BusinessCalendar{std::span<const double>{}, zone};
+  }
+
+  if (const auto holidays = TimestampArrayFrom(runtime, args[index])) {
+    return std::visit(
+        [&](auto elements) {
+          using Element = typename decltype(elements)::element_type;
+          return Helpers::BusinessCalendar{std::span<const Element>{elements}, zone};
+        },
+        *holidays);
+  }
+
+  std::vector<double> holidays;
+  if (args[index].isObject() && args[index].getObject(runtime).isArray(runtime)) {
+    const auto array = args[index].getObject(runtime).getArray(runtime);
+    holidays.reserve(array.size(runtime));
+    for (size_t i = 0; i < array.size(runtime); ++i) {
+      const auto holiday = array.getValueAtIndex(runtime, i);
+      if (holiday.isNumber()) {
+        holidays.push_back(holiday.asNumber());
+      }
+    }
+  }
+  return Helpers::BusinessCalendar{std::span<const double>{holidays}, zone};
+}
+
+Value AddCalendarUnits(Runtime &runtime, const Value *args, size_t count) {
+  auto dates = count > 0 ? TimestampArrayFrom(runtime, args[0]) : std::nullopt;
+  if (!dates) {
+    return Value::undefined();
+  }
+
+  const auto years = Helpers::OffsetUnitsFrom(NumberAt(args, count, 1));
+  const auto months = Helpers::OffsetUnitsFrom(NumberAt(args, count, 2));
+  const auto days = Helpers::OffsetUnitsFrom(NumberAt(args, count, 3));
+  if (!years || !months || !days) {
+    FillInvalid(*dates);
+    return Value(runtime, args[0]);
+  }
+
+  const auto clock = Helpers::SystemClock();
+  auto zone = Helpers::ZoneOffsets::From(OptionalNumberAt(args, count, 4), *clock);
+  const Helpers::CalendarOffset offset{*years, *months, *days};
+  std::visit([&](auto elements) { Helpers::AddCalendarOffset(elements, offset, zone); }, *dates);
+  return Value(runtime, args[0]);
+}
+
+Value AddBusinessDays(Runtime &runtime, const Value *args, size_t count) {
+  auto dates = count > 0 ? TimestampArrayFrom(runtime, args[0]) : std::nullopt;
+  if (!dates) {
+    return Value::undefined();
+  }
+
+  const auto businessDays = Helpers::OffsetUnitsFrom(NumberAt(args, count, 1));
+  if (!businessDays) {
+    FillInvalid(*dates);
+    return Value(runtime, args[0]);
+  }
+
+  const auto clock = Helpers::SystemClock();
+  auto zone = Helpers::ZoneOffsets::From(OptionalNumberAt(args, count, 3), *clock);
+  const auto calendar = CalendarFrom(runtime, args, count, 2, zone);
+  std::visit([&](auto elements) { Helpers::AddBusinessDays(elements, *businessDays, calendar, zone); }, *dates);
+  return Value(runtime, args[0]);
+}
+
+Value ClampDates(Runtime &runtime, const Value *args, size_t count) {
+  auto dates = count > 0 ? TimestampArrayFrom(runtime, args[0]) : std::nullopt;
+  if (!dates) {
+    return Value::undefined();
+  }
+
+  const auto minimum = OptionalNumberAt(args, count, 1);
+  const auto maximum = OptionalNumberAt(args, count, 2);
+  std::visit([&](auto elements) { Helpers::ClampTimestamps(elements, minimum, maximum); }, *dates);
+  return Value(runtime, args[0]);
+}
+
+Value NextBusinessDays(Runtime &runtime, const Value *args, size_t count) {
+  const double length = NumberAt(args, count, 1);
+  const auto clock = Helpers::SystemClock();
+  auto zone = Helpers::ZoneOffsets::From(OptionalNumberAt(args, count, 3), *clock);
+  const auto calendar = CalendarFrom(runtime, args, count, 2, zone);
+  const auto days = length >= 1
+      ? Helpers::NextBusinessDays(
+            NumberAt(args, count, 0), static_cast<size_t>(std::min(length, kMaxBusinessDayList)), calendar, zone)
+      : std::vector<double>{};
+
+  auto [array, elements] = NewFloat64Array(runtime, days.size());
+  std::copy(days.begin(), days.end(), elements.begin());
+  return Value(std::move(array));
+}
+
+Value IntersectDateRanges(Runtime &runtime, const Value *args, size_t count) {
+  const auto first = count > 0 ? TimestampArrayFrom(runtime, args[0]) : std::nullopt;
+  const auto second = count > 1 ? TimestampArrayFrom(runtime, args[1]) : std::nullopt;
+  if (!first || !second) {
+    return Value::undefined();
+  }
+
+  const auto ranges = std::visit(
+      [](auto firstElements, auto secondElements) {
+        using First = typename decltype(firstElements)::element_type;
+        using Second = typename decltype(secondElements)::element_type;
+        return Helpers::IntersectRanges(std::span<const First>{firstElements}, std::span<const Second>{secondElements});
+      },
+      *first,
+      *second);
+
+  auto [array, elements] = NewFloat64Array(runtime, ranges.size());
+  std::copy(ranges.begin(), ranges.end(), elements.begin());
+  return Value(std::move(array));
+}
+
+} // anonymous namespace
+
+facebook::jsi::Value GetPickerDateMathFunction(facebook::jsi::Runtime &runtime,
+                                               const facebook::jsi::PropNameID &name,
+                                               std::string_view propName) {
+  using Function = Value (*)(Runtime &, const Value *, size_t);
+  Function function = nullptr;
+  unsigned int paramCount = 0;
+  if (propName == "addCalendarUnits") {
+    function = &AddCalendarUnits;
+    paramCount = 5;
+  } else if (propName == "addBusinessDays") {
+    function = &AddBusinessDays;
+    paramCount = 4;
+  } else if (propName == "clampDates") {
+    function = &ClampDates;
+    paramCount = 3;
+  } else if (propName == "nextBusinessDays") {
+    function = &NextBusinessDays;
+    paramCount = 4;
+  } else if (propName == "intersectDateRanges") {
+    function = &IntersectDateRanges;
+    paramCount = 2;
+  } else {
+    return Value::undefined();
+  }
+
+  return facebook::jsi::Function::createFromHostFunction(
+      runtime,
+      name,
+      paramCount,
+      [function](Runtime &runtime, const Value & /*thisValue*/, const Value *args, size_t count) -> Value {
+        return function(runtime, args, count);
+      });
+}
+
+} // namespace winrt::DateTimePicker
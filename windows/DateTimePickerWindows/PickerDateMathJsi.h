@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <JSI/JsiApiContext.h>
+
+#include <string_view>
+
+namespace winrt::DateTimePicker {
+
+// Typed-array variants of the PickerDateMathModule operations, exposed on the
+// global.__rnDateTimePickerValues host object (see PickerValuesModuleWindows.h). They read and
+// write Float64Array and BigInt64Array buffers in place instead of converting every element
+// through JSValue; invalid BigInt64 timestamps are INT64_MIN.
+//   addCalendarUnits(dates, years, months, days, timeZoneOffsetInSeconds?) -> dates
+//   addBusinessDays(dates, count, holidays?, timeZoneOffsetInSeconds?)     -> dates
+//   clampDates(dates, minimumDate?, maximumDate?)                          -> dates
+//   nextBusinessDays(start, count, holidays?, timeZoneOffsetInSeconds?)    -> Float64Array
+//   intersectDateRanges(first, second)                                     -> Float64Array
+// Holidays may be a typed array or a plain array of numbers.
+
+// Names of the functions, for getPropertyNames()
+inline constexpr std::string_view kPickerDateMathFunctions[] = {
+    "addCalendarUnits", "addBusinessDays", "clampDates", "nextBusinessDays", "intersectDateRanges"};
+
+// Returns the function with the given name, or undefined when the name is not one of them.
+facebook::jsi::Value GetPickerDateMathFunction(facebook::jsi::Runtime &runtime,
+                                               const facebook::jsi::PropNameID &name,
+                                               std::string_view propName);
+
+} // namespace winrt::DateTimePicker
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PickerDateMathModuleWindows.h"
+#include "DateMath.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace winrt::DateTimePicker {
+
+namespace {
+
+// Longest list nextBusinessDays() returns
+constexpr double kMaxBusinessDayList = 1 << 20;
+
+void FillInvalid(std::vector<double> &dates) noexcept {
+  std::fill(dates.begin(), dates.end(), std::numeric_limits<double>::quiet_NaN());
+}
+
+} // anonymous namespace
+
+std::vector<double> PickerDateMathModule::AddCalendarUnits(std::vector<double> dates,
+                                                           double years,
+                                                           double months,
+                                                           double days,
+                                                           std::optional<double> timeZoneOffsetInSeconds) noexcept {
+  const auto wholeYears = Helpers::OffsetUnitsFrom(years);
+  const auto wholeMonths = Helpers::OffsetUnitsFrom(months);
+  const auto wholeDays = Helpers::OffsetUnitsFrom(days);
+  if (!wholeYears || !wholeMonths || !wholeDays) {
+    FillInvalid(dates);
+    return dates;
+  }
+
+  const auto clock = Helpers::SystemClock();
+  auto zone = Helpers::ZoneOffsets::From(timeZoneOffsetInSeconds, *clock);
+  Helpers::AddCalendarOffset(std::span<double>{dates}, Helpers::CalendarOffset{*wholeYears, *wholeMonths, *wholeDays}, zone);
+  return dates;
+}
+
+std::vector<double> PickerDateMathModule::AddBusinessDays(std::vector<double> dates,
+                                                          double count,
+                                                          std::vector<double> holidays,
+                                                          std::optional<double> timeZoneOffsetInSeconds) noexcept {
+  const auto wholeCount = Helpers::OffsetUnitsFrom(count);
+  if (!wholeCount) {
+    FillInvalid(dates);
+    return dates;
+  }
+
+  try {
+    const auto clock = Helpers::SystemClock();
+    auto zone = Helpers::ZoneOffsets::From(timeZoneOffsetInSeconds, *clock);
+    const Helpers::BusinessCalendar calendar{std::span<const double>{holidays}, zone};
+    Helpers::AddBusinessDays(std::span<double>{dates}, *wholeCount, calendar, zone);
+  } catch (...) {
+    FillInvalid(dates);
+  }
+  return dates;
+}
+
+std::vector<double> PickerDateMathModule::NextBusinessDays(double start,
+                                                           double count,
+                                                           std::vector<double> holidays,
+                                                           std::optional<double> timeZoneOffsetInSeconds) noexcept {
+  if (!(count >= 1)) {
+    return {};
+  }
+
+  try {
+    const auto clock = Helpers::SystemClock();
+    auto zone = Helpers::ZoneOffsets::From(timeZoneOffsetInSeconds, *clock);
+    const Helpers::BusinessCalendar calendar{std::span<const double>{holidays}, zone};
+    return Helpers::NextBusinessDays(start, static_cast<size_t>(std::min(count, kMaxBusinessDayList)), calendar, zone);
+  } catch (...) {
+    return {};
+  }
+}
+
+std::vector<double> PickerDateMathModule::ClampDates(std::vector<double> dates,
+                                                     std::optional<double> minimumDate,
+                                                     std::optional<double> maximumDate) noexcept {
+  Helpers::ClampTimestamps(std::span<double>{dates}, minimumDate, maximumDate);
+  return dates;
+}
+
+std::vector<double> PickerDateMathModule::IntersectDateRanges(std::vector<double> first, std::vector<double> second) noexcept {
+  try {
+    return Helpers::IntersectRanges(std::span<const double>{first}, std::span<const double>{second});
+  } catch (...) {
+    return {};
+  }
+}
+
+} // namespace winrt::DateTimePicker
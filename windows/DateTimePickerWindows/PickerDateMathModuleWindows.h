@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "NativeModules.h"
+
+#include <optional>
+#include <vector>
+
+namespace winrt::DateTimePicker {
+
+// PickerDateMathModule runs the date arithmetic around pickers (allowed ranges, next business days,
+// end-of-month clamping) over whole arrays of timestamps in one synchronous call, on the civil-date
+// kernel in DateMath.h. Dates are computed in the local time zone, or at timeZoneOffsetInSeconds
+// from UTC when given, and keep their time of day. Invalid timestamps come back as NaN.
+REACT_MODULE(PickerDateMathModule, L"RNCPickerDateMathWindows")
+struct PickerDateMathModule {
+  using ModuleSpec = ReactNativeSpecs::PickerDateMathModuleWindowsSpec;
+
+  // Adds years and months, clamping the day to the end of the target month, then days
+  REACT_SYNC_METHOD(AddCalendarUnits, L"addCalendarUnits")
+  std::vector<double> AddCalendarUnits(std::vector<double> dates,
+                                       double years,
+                                       double months,
+                                       double days,
+                                       std::optional<double> timeZoneOffsetInSeconds) noexcept;
+
+  // Moves each date by count business days (Monday to Friday, minus holidays)
+  REACT_SYNC_METHOD(AddBusinessDays, L"addBusinessDays")
+  std::vector<double> AddBusinessDays(std::vector<double> dates,
+                                      double count,
+                                      std::vector<double> holidays,
+                                      std::optional<double> timeZoneOffsetInSeconds) noexcept;
+
+  // The count business days following start
+  REACT_SYNC_METHOD(NextBusinessDays, L"nextBusinessDays")
+  std::vector<double> NextBusinessDays(double start,
+                                       double count,
+                                       std::vector<double> holidays,
+                                       std::optional<double> timeZoneOffsetInSeconds) noexcept;
+
+  REACT_SYNC_METHOD(ClampDates, L"clampDates")
+  std::vector<double> ClampDates(std::vector<double> dates,
+                                 std::optional<double> minimumDate,
+                                 std::optional<double> maximumDate) noexcept;
+
+  // Intersects two sets of inclusive [start, end] ranges given as flat pairs
+  REACT_SYNC_METHOD(IntersectDateRanges, L"intersectDateRanges")
+  std::vector<double> IntersectDateRanges(std::vector<double> first, std::vector<double> second) noexcept;
+};
+
+} // namespace winrt::DateTimePicker
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PickerEventBatchModuleWindows.h"
+#include "PickerWindow.h"
+
+#include <winrt/Microsoft.UI.Xaml.Media.h>
+
+#include <atomic>
+#include <memory>
+
+namespace winrt::DateTimePicker {
+
+namespace {
+
+// Runs the callback on the next XAML frame, then unsubscribes.
+class XamlFrameScheduler final : public Helpers::IFrameScheduler {
+public:
+  void RequestFrame(std::function<void()> onFrame) override {
+    m_renderingRevoker = winrt::Microsoft::UI::Xaml::Media::CompositionTarget::Rendering(
+        winrt::auto_revoke, [this, onFrame = std::move(onFrame)](auto const & /*sender*/, auto const & /*args*/) {
+          m_renderingRevoker.revoke();
+          onFrame();
+        });
+  }
+
+private:
+  winrt::Microsoft::UI::Xaml::Media::CompositionTarget::Rendering_revoker m_renderingRevoker;
+};
+
+std::atomic<bool> g_batchingEnabled{false};
+
+} // anonymous namespace
+
+void PickerEventBatchModule::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
+  if (!g_batchingEnabled.load()) {
+    return;
+  }
+
+  // Each window batches its own views' events and delivers them to its own instance
+  auto window = GetPickerWindow(reactContext.Handle());
+  std::atomic_store(
+      &window->batcher,
+      std::make_shared<PickerEventBatcher>(
+          std::make_shared<XamlFrameScheduler>(), [reactContext](std::vector<PickerEventBatcher::Entry> &&entries) {
+            winrt::Microsoft::ReactNative::JSValueArray batch;
+            batch.reserve(entries.size());
+            for (auto &entry : entries) {
+              entry.payload["target"] = entry.tag;
+              if (entry.valuesSkipped) {
+                entry.payload["valuesSkipped"] = true;
+              }
+              batch.push_back(winrt::Microsoft::ReactNative::JSValue{std::move(entry.payload)});
+            }
+            reactContext.EmitJSEvent(L"RCTDeviceEventEmitter", L"dateTimePickerBatchedChange", std::move(batch));
+          }));
+  m_window = std::move(window);
+}
+
+void EnablePickerEventBatching() noexcept {
+  g_batchingEnabled.store(true);
+}
+
+bool IsPickerEventBatchingActive(const PickerWindow &window) noexcept {
+  return std::atomic_load(&window.batcher) != nullptr;
+}
+
+void BatchPickerEvent(PickerWindow &window, int64_t viewTag, winrt::Microsoft::ReactNative::JSValueObject &&payload) noexcept {
+  if (auto batcher = std::atomic_load(&window.batcher)) {
+    batcher->Enqueue(viewTag, std::move(payload));
+  }
+}
+
+} // namespace winrt::DateTimePicker
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "NativeModules.h"
+#include "PickerWindow.h"
+
+#include <memory>
+
+namespace winrt::DateTimePicker {
+
+// PickerEventBatchModule delivers change events from all Fabric picker views of its window as a single
+// "dateTimePickerBatchedChange" device event per UI frame, with an array payload whose entries
+// carry the view tag in "target". Batching is opt-in through ReactPackageProvider::BatchChangeEvents.
+REACT_MODULE(PickerEventBatchModule)
+struct PickerEventBatchModule {
+  REACT_INIT(Initialize)
+  void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
+
+ private:
+  // Keeps the window, and with it the batcher, alive as long as the instance
+  std::shared_ptr<PickerWindow> m_window;
+};
+
+// Turns batching on for instances created after this call. Called from ReactPackageProvider::CreatePackage.
+void EnablePickerEventBatching() noexcept;
+
+// True once the window's batch module has been initialized with batching enabled. When false,
+// views dispatch change events on their own emitters.
+bool IsPickerEventBatchingActive(const PickerWindow &window) noexcept;
+
+// Queues a change event for batched delivery on the window's next frame.
+void BatchPickerEvent(PickerWindow &window, int64_t viewTag, winrt::Microsoft::ReactNative::JSValueObject &&payload) noexcept;
+
+} // namespace winrt::DateTimePicker
@@ -0,0 +1,217 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+
+#include "PickerIslandPool.h"
+
+#if defined(RNW_NEW_ARCH)
+
+#include "InstancePool.h"
+
+#include <winrt/Microsoft.UI.Dispatching.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace winrt::DateTimePicker {
+
+namespace {
+
+using winrt::Microsoft::UI::Xaml::FrameworkElement;
+using winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker;
+using winrt::Microsoft::UI::Xaml::Controls::TimePicker;
+
+// Upper bound on pooled controls per control type and thread, whatever the configured warm-up size
+constexpr size_t kPickerIslandPoolCapacity = 16;
+
+std::atomic<uint32_t> g_poolSize{0};
+Helpers::InstancePoolMetrics g_calendarDatePickerMetrics;
+Helpers::InstancePoolMetrics g_timePickerMetrics;
+
+// Controls are bound to the thread that created them, so controls released elsewhere are not pooled
+template <typename TControl>
+bool CanPool(const TControl &control) {
+  return control && control.DispatcherQueue().HasThreadAccess();
+}
+
+bool ResetCalendarDatePicker(CalendarDatePicker &control) {
+  if (!CanPool(control)) {
+    return false;
+  }
+  try {
+    control.IsCalendarOpen(false);
+    control.ClearValue(CalendarDatePicker::DateProperty());
+    control.ClearValue(CalendarDatePicker::MinDateProperty());
+    control.ClearValue(CalendarDatePicker::MaxDateProperty());
+    control.ClearValue(CalendarDatePicker::DateFormatProperty());
+    control.ClearValue(CalendarDatePicker::DayOfWeekFormatProperty());
+    control.ClearValue(CalendarDatePicker::FirstDayOfWeekProperty());
+    control.ClearValue(CalendarDatePicker::PlaceholderTextProperty());
+    control.ClearValue(FrameworkElement::NameProperty());
+    return true;
+  } catch (const winrt::hresult_error &) {
+    return false;
+  }
+}
+
+bool ResetTimePicker(TimePicker &control) {
+  if (!CanPool(control)) {
+    return false;
+  }
+  try {
+    control.ClearValue(TimePicker::TimeProperty());
+    control.ClearValue(TimePicker::SelectedTimeProperty());
+    control.ClearValue(TimePicker::ClockIdentifierProperty());
+    control.ClearValue(TimePicker::MinuteIncrementProperty());
+    return true;
+  } catch (const winrt::hresult_error &) {
+    return false;
+  }
+}
+
+// The pools of one UI thread. Cleared on that thread when its React instance is destroyed (see
+// ClearPickerIslandPools); whatever is left at thread exit is abandoned rather than released,
+// because the XAML core of the thread may already be gone by then.
+struct ThreadPickerPools {
+  Helpers::InstancePool<CalendarDatePicker> calendarDatePickers{
+      kPickerIslandPoolCapacity,
+      []() { return CalendarDatePicker{}; },
+      &ResetCalendarDatePicker,
+      g_calendarDatePickerMetrics};
+  Helpers::InstancePool<TimePicker> timePickers{
+      kPickerIslandPoolCapacity, []() { return TimePicker{}; }, &ResetTimePicker, g_timePickerMetrics};
+
+  ~ThreadPickerPools() {
+    for (auto &control : calendarDatePickers.TakeAll()) {
+      winrt::detach_abi(control);
+    }
+    for (auto &control : timePickers.TakeAll()) {
+      winrt::detach_abi(control);
+    }
+  }
+};
+
+ThreadPickerPools &PickerPools() {
+  thread_local ThreadPickerPools pools;
+  return pools;
+}
+
+// Every view gets a new island: a ContentIsland is connected to a single parent for its
+// lifetime, so only the control is reused
+template <typename TControl>
+PickerIsland<TControl> HostInNewIsland(TControl control) {
+  PickerIsland<TControl> pickerIsland{winrt::Microsoft::UI::Xaml::XamlIsland{}, std::move(control)};
+  pickerIsland.island.Content(pickerIsland.control);
+  return pickerIsland;
+}
+
+// Takes the control out of the island it was shown in and closes that island
+template <typename TControl>
+TControl DetachFromIsland(PickerIsland<TControl> &&pickerIsland) noexcept {
+  if (pickerIsland.island) {
+    try {
+      pickerIsland.island.Content(nullptr);
+      pickerIsland.island.Close();
+    } catch (const winrt::hresult_error &) {
+    }
+  }
+  return std::move(pickerIsland.control);
+}
+
+thread_local bool t_warmUpScheduled = false;
+
+// Fills the calling thread's pools one pair per idle callback, so warm-up never holds up a frame
+void EnqueueWarmUpStep(winrt::Microsoft::UI::Dispatching::DispatcherQueue const &dispatcherQueue) {
+  t_warmUpScheduled = dispatcherQueue.TryEnqueue(
+      winrt::Microsoft::UI::Dispatching::DispatcherQueuePriority::Low, [dispatcherQueue]() {
+        bool moreWork = false;
+        try {
+          auto &pools = PickerPools();
+          moreWork = pools.calendarDatePickers.WarmStep();
+          moreWork = pools.timePickers.WarmStep() || moreWork;
+        } catch (const winrt::hresult_error &) {
+        }
+
+        t_warmUpScheduled = false;
+        if (moreWork) {
+          EnqueueWarmUpStep(dispatcherQueue);
+        }
+      });
+}
+
+void ScheduleWarmUp() {
+  const size_t target = g_poolSize.load(std::memory_order_relaxed);
+  if (t_warmUpScheduled || target == 0) {
+    return;
+  }
+
+  auto dispatcherQueue = winrt::Microsoft::UI::Dispatching::DispatcherQueue::GetForCurrentThread();
+  if (!dispatcherQueue) {
+    return;
+  }
+
+  auto &pools = PickerPools();
+  pools.calendarDatePickers.WarmTarget(target);
+  pools.timePickers.WarmTarget(target);
+  EnqueueWarmUpStep(dispatcherQueue);
+}
+
+} // anonymous namespace
+
+CalendarDatePickerIsland AcquireCalendarDatePickerIsland() {
+  auto pickerIsland = HostInNewIsland(PickerPools().calendarDatePickers.Acquire());
+  ScheduleWarmUp();
+  return pickerIsland;
+}
+
+void ReleaseCalendarDatePickerIsland(CalendarDatePickerIsland &&pickerIsland) noexcept {
+  try {
+    PickerPools().calendarDatePickers.Release(DetachFromIsland(std::move(pickerIsland)));
+  } catch (...) {
+  }
+}
+
+TimePickerIsland AcquireTimePickerIsland() {
+  auto pickerIsland = HostInNewIsland(PickerPools().timePickers.Acquire());
+  ScheduleWarmUp();
+  return pickerIsland;
+}
+
+void ReleaseTimePickerIsland(TimePickerIsland &&pickerIsland) noexcept {
+  try {
+    PickerPools().timePickers.Release(DetachFromIsland(std::move(pickerIsland)));
+  } catch (...) {
+  }
+}
+
+void ClearPickerIslandPools() noexcept {
+  try {
+    auto &pools = PickerPools();
+    pools.calendarDatePickers.Clear();
+    pools.timePickers.Clear();
+  } catch (...) {
+  }
+}
+
+void SetPickerIslandPoolSize(uint32_t size) noexcept {
+  g_poolSize.store(static_cast<uint32_t>(std::min<size_t>(size, kPickerIslandPoolCapacity)), std::memory_order_relaxed);
+}
+
+PickerIslandPoolStats GetPickerIslandPoolStats() noexcept {
+  const auto sum = [](const std::atomic<int64_t> &first, const std::atomic<int64_t> &second) {
+    return first.load(std::memory_order_relaxed) + second.load(std::memory_order_relaxed);
+  };
+  const auto &date = g_calendarDatePickerMetrics;
+  const auto &time = g_timePickerMetrics;
+  return PickerIslandPoolStats{
+      sum(date.hits, time.hits),
+      sum(date.misses, time.misses),
+      sum(date.returned, time.returned),
+      sum(date.discarded, time.discarded),
+      sum(date.warmed, time.warmed)};
+}
+
+} // namespace winrt::DateTimePicker
+
+#endif // defined(RNW_NEW_ARCH)
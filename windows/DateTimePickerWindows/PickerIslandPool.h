@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if defined(RNW_NEW_ARCH)
+
+#include <winrt/Microsoft.UI.Xaml.Controls.h>
+
+#include <cstdint>
+
+namespace winrt::DateTimePicker {
+
+// A XamlIsland that already hosts its picker control, ready to be connected to a Fabric view.
+template <typename TControl>
+struct PickerIsland {
+  winrt::Microsoft::UI::Xaml::XamlIsland island{nullptr};
+  TControl control{nullptr};
+};
+
+using CalendarDatePickerIsland = PickerIsland<winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker>;
+using TimePickerIsland = PickerIsland<winrt::Microsoft::UI::Xaml::Controls::TimePicker>;
+
+// Picker controls are pooled per UI thread (see InstancePool.h). Views take a pair when they mount
+// and return it when they are destroyed; the control of a returned pair has every property the
+// views set cleared and is shown in a new island next time, as islands are never reconnected.
+// Acquiring also schedules idle-time warm-up of the calling thread's pools.
+CalendarDatePickerIsland AcquireCalendarDatePickerIsland();
+void ReleaseCalendarDatePickerIsland(CalendarDatePickerIsland &&pickerIsland) noexcept;
+
+TimePickerIsland AcquireTimePickerIsland();
+void ReleaseTimePickerIsland(TimePickerIsland &&pickerIsland) noexcept;
+
+// Releases the calling thread's pooled controls. Call it on a UI thread whose React instance is
+// being destroyed, while its XAML core is still alive.
+void ClearPickerIslandPools() noexcept;
+
+// Number of controls of each control type that idle warm-up keeps ready on every UI thread. 0 disables warm-up.
+void SetPickerIslandPoolSize(uint32_t size) noexcept;
+
+struct PickerIslandPoolStats {
+  int64_t hits;
+  int64_t misses;
+  int64_t returned;
+  int64_t discarded;
+  int64_t warmed;
+};
+
+// Counters summed over both control types and all threads.
+PickerIslandPoolStats GetPickerIslandPoolStats() noexcept;
+
+} // namespace winrt::DateTimePicker
+
+#endif // defined(RNW_NEW_ARCH)
@@ -0,0 +1,321 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Prop and event handling of the pickers, written against the interfaces in PickerControls.h.
+// Updates run in two phases: BuildPlan, or a plan builder fed as props are parsed, does the
+// conversions on any thread and Apply runs the setters on the control's thread (see
+// PickerApplyPlan.h). Header-only, so it can run against headless controls.
+
+#include "DayAnchor.h"
+#include "PickerApplyPlan.h"
+#include "PickerControls.h"
+
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Converts milliseconds since the Unix epoch to the wall-clock seconds a date control shows.
+/// </summary>
+constexpr int64_t WallSecondsFromMilliseconds(int64_t timeInMilliseconds, int64_t timeZoneOffsetInSeconds) noexcept {
+  return timeInMilliseconds / 1000 + timeZoneOffsetInSeconds;
+}
+
+/// <summary>
+/// Converts the wall-clock seconds of a date control back to milliseconds since the Unix epoch.
+/// </summary>
+inline int64_t MillisecondsFromWallSeconds(int64_t wallSeconds, int64_t timeZoneOffsetInSeconds) {
+  const int64_t timeInUtc = wallSeconds - timeZoneOffsetInSeconds;
+  if (std::numeric_limits<int64_t>::max() / 1000 < timeInUtc) {
+    throw std::overflow_error("Provided date value is too large.");
+  }
+  return timeInUtc * 1000;
+}
+
+/// <summary>
+/// Plans DateTimePicker props one at a time, for props objects that are filled as they are
+/// parsed. Keeps every prop seen, so it gives both the changes since ResetChanges and a plan
+/// that brings any control up to date. Dates are kept in milliseconds and re-planned when the
+/// time zone offset changes. Not thread-safe; copies carry the props seen so far.
+/// </summary>
+class DatePlanBuilder {
+public:
+  void SetProp(std::string_view propertyName, const PickerPropValue &propertyValue) {
+    if (propertyName == "dayOfWeekFormat") {
+      PlanText(&DateApplyPlan::dayOfWeekFormat, propertyValue);
+    } else if (propertyName == "dateFormat") {
+      PlanText(&DateApplyPlan::dateFormat, propertyValue);
+    } else if (propertyName == "firstDayOfWeek") {
+      if (propertyValue.IsNull()) {
+        Plan(&DateApplyPlan::firstDayOfWeek, std::nullopt);
+      } else {
+        Plan(&DateApplyPlan::firstDayOfWeek, std::optional<int32_t>{static_cast<int32_t>(propertyValue.AsInt64())});
+      }
+    } else if (propertyName == "maxDate") {
+      PlanDate(&DateApplyPlan::maxDate, m_maxTime, propertyValue);
+    } else if (propertyName == "minDate") {
+      PlanDate(&DateApplyPlan::minDate, m_minTime, propertyValue);
+    } else if (propertyName == "placeholderText") {
+      PlanText(&DateApplyPlan::placeholderText, propertyValue);
+    } else if (propertyName == "selectedDate") {
+      PlanDate(&DateApplyPlan::date, m_selectedTime, propertyValue);
+    } else if (propertyName == "timeZoneOffsetInSeconds") {
+      const int64_t offset = propertyValue.IsNull() ? 0 : propertyValue.AsInt64();
+      if (offset != m_all.timeZoneOffsetInSeconds) {
+        m_all.timeZoneOffsetInSeconds = m_changes.timeZoneOffsetInSeconds = offset;
+        ReplanDate(&DateApplyPlan::maxDate, m_maxTime);
+        ReplanDate(&DateApplyPlan::minDate, m_minTime);
+        ReplanDate(&DateApplyPlan::date, m_selectedTime);
+      }
+    } else if (propertyName == "accessibilityLabel") {
+      if (!propertyValue.IsNull()) {
+        Plan(&DateApplyPlan::name, std::optional<PickerText>{PickerTextFromUtf8(propertyValue.AsString())});
+      }
+    }
+  }
+
+  /// <summary>
+  /// Setters for the props set since the last ResetChanges.
+  /// </summary>
+  const DateApplyPlan &Changes() const noexcept {
+    return m_changes;
+  }
+
+  /// <summary>
+  /// Setters for every prop set so far, including the ones that were cleared.
+  /// </summary>
+  const DateApplyPlan &All() const noexcept {
+    return m_all;
+  }
+
+  /// <summary>
+  /// Starts collecting the changes of the next update.
+  /// </summary>
+  void ResetChanges() noexcept {
+    m_changes = DateApplyPlan{};
+    m_changes.timeZoneOffsetInSeconds = m_all.timeZoneOffsetInSeconds;
+  }
+
+private:
+  template <typename T>
+  void Plan(PlannedValue<T> DateApplyPlan::*field, const std::optional<std::type_identity_t<T>> &value) {
+    for (auto *plan : {&m_changes, &m_all}) {
+      if (value) {
+        (plan->*field).Set(*value);
+      } else {
+        (plan->*field).Clear();
+      }
+    }
+  }
+
+  void PlanText(PlannedValue<PickerText> DateApplyPlan::*field, const PickerPropValue &value) {
+    Plan(field, value.IsNull() ? std::nullopt : std::optional<PickerText>{PickerTextFromUtf8(value.AsString())});
+  }
+
+  void PlanDate(PlannedValue<int64_t> DateApplyPlan::*field, std::optional<int64_t> &time, const PickerPropValue &value) {
+    time = value.IsNull() ? std::nullopt : std::optional<int64_t>{value.AsInt64()};
+    Plan(field, time ? std::optional<int64_t>{WallSecondsFromMilliseconds(*time, m_all.timeZoneOffsetInSeconds)} : std::nullopt);
+  }
+
+  void ReplanDate(PlannedValue<int64_t> DateApplyPlan::*field, const std::optional<int64_t> &time) {
+    if (time) {
+      Plan(field, std::optional<int64_t>{WallSecondsFromMilliseconds(*time, m_all.timeZoneOffsetInSeconds)});
+    }
+  }
+
+  std::optional<int64_t> m_selectedTime, m_maxTime, m_minTime;
+  DateApplyPlan m_changes;
+  DateApplyPlan m_all;
+};
+
+/// <summary>
+/// Applies DateTimePicker props to a date control and turns its changes into events.
+/// </summary>
+class DatePickerLogic {
+public:
+  /// <summary>
+  /// Prepares the setters for an update. Thread-safe; does not touch the control.
+  /// </summary>
+  DateApplyPlan BuildPlan(const IPickerPropReader &props, PickerApplyStats &stats = SharedApplyStats()) {
+    std::lock_guard<std::mutex> lock{m_planMutex};
+    m_planBuilder.ResetChanges();
+    props.ForEach([&](std::string_view propertyName, const PickerPropValue &propertyValue) {
+      m_planBuilder.SetProp(propertyName, propertyValue);
+    });
+
+    stats.plans.fetch_add(1, std::memory_order_relaxed);
+    return m_planBuilder.Changes();
+  }
+
+  /// <summary>
+  /// Executes a plan on the control's thread. Changes it causes are not reported.
+  /// </summary>
+  void Apply(const DateApplyPlan &plan, IDateControl &control, PickerApplyStats &stats = SharedApplyStats()) {
+    ScopedApplyTimer timer{stats};
+    m_updating = true;
+    m_timeZoneOffsetInSeconds = plan.timeZoneOffsetInSeconds;
+    ApplyPlan(plan, control);
+    m_updating = false;
+  }
+
+  /// <summary>
+  /// Builds and applies a plan in one step, for callers already on the control's thread.
+  /// </summary>
+  void UpdateProps(const IPickerPropReader &props, IDateControl &control) {
+    Apply(BuildPlan(props), control);
+  }
+
+  /// <summary>
+  /// Handles a date picked in the control. Changes made by Apply are not reported.
+  /// </summary>
+  void OnDateChanged(int64_t wallSeconds, IPickerEventEmitter &emitter) {
+    if (!m_updating) {
+      emitter.EmitChange(MillisecondsFromWallSeconds(wallSeconds, m_timeZoneOffsetInSeconds));
+    }
+  }
+
+  /// <summary>
+  /// Offset of the last applied plan.
+  /// </summary>
+  int64_t TimeZoneOffsetInSeconds() const noexcept {
+    return m_timeZoneOffsetInSeconds;
+  }
+
+private:
+  // Props only carry the offset when it changes, so plans build on the props seen before
+  std::mutex m_planMutex;
+  DatePlanBuilder m_planBuilder;
+
+  // Control thread state
+  bool m_updating{false};
+  int64_t m_timeZoneOffsetInSeconds{0};
+};
+
+/// <summary>
+/// Plans TimePicker props one at a time, like DatePlanBuilder. Times are planned as the local
+/// time of day held by the day anchor when the prop is set.
+/// </summary>
+class TimePlanBuilder {
+public:
+  explicit TimePlanBuilder(const DayAnchor &anchor) noexcept : m_anchor(&anchor) {}
+
+  void SetProp(std::string_view propertyName, const PickerPropValue &propertyValue) {
+    if (propertyName == "selectedTime") {
+      if (propertyValue.IsNull()) {
+        Plan(&TimeApplyPlan::time, std::nullopt);
+      } else {
+        // Incoming value will be in milliseconds from Jan 1, 1970.
+        // Only whole minutes elapsed since local midnight are shown.
+        const int64_t minutes = m_anchor->LocalTimeOfDayMilliseconds(propertyValue.AsInt64()) / (1000 * 60);
+        Plan(&TimeApplyPlan::time, std::optional<int64_t>{minutes * 60 * 1000});
+      }
+    } else if (propertyName == "is24Hour") {
+      Plan(&TimeApplyPlan::is24Hour, propertyValue.IsNull() ? std::nullopt : std::optional<bool>{propertyValue.AsBoolean()});
+    } else if (propertyName == "minuteInterval") {
+      if (propertyValue.IsNull()) {
+        Plan(&TimeApplyPlan::minuteIncrement, std::nullopt);
+      } else {
+        Plan(&TimeApplyPlan::minuteIncrement, std::optional<int32_t>{static_cast<int32_t>(propertyValue.AsInt64())});
+      }
+    }
+  }
+
+  /// <summary>
+  /// Setters for the props set since the last ResetChanges.
+  /// </summary>
+  const TimeApplyPlan &Changes() const noexcept {
+    return m_changes;
+  }
+
+  /// <summary>
+  /// Setters for every prop set so far, including the ones that were cleared.
+  /// </summary>
+  const TimeApplyPlan &All() const noexcept {
+    return m_all;
+  }
+
+  /// <summary>
+  /// Starts collecting the changes of the next update.
+  /// </summary>
+  void ResetChanges() noexcept {
+    m_changes = TimeApplyPlan{};
+  }
+
+private:
+  template <typename T>
+  void Plan(PlannedValue<T> TimeApplyPlan::*field, const std::optional<std::type_identity_t<T>> &value) {
+    for (auto *plan : {&m_changes, &m_all}) {
+      if (value) {
+        (plan->*field).Set(*value);
+      } else {
+        (plan->*field).Clear();
+      }
+    }
+  }
+
+  const DayAnchor *m_anchor;
+  TimeApplyPlan m_changes;
+  TimeApplyPlan m_all;
+};
+
+/// <summary>
+/// Applies TimePicker props to a time control and turns its changes into events. Times are
+/// shown as the local time of day, and reported on today's date as held by the day anchor.
+/// </summary>
+class TimePickerLogic {
+public:
+  explicit TimePickerLogic(const DayAnchor &anchor) noexcept : m_anchor(anchor) {}
+
+  /// <summary>
+  /// Prepares the setters for an update. Thread-safe; does not touch the control.
+  /// </summary>
+  TimeApplyPlan BuildPlan(const IPickerPropReader &props, PickerApplyStats &stats = SharedApplyStats()) const {
+    TimePlanBuilder builder{m_anchor};
+    props.ForEach([&](std::string_view propertyName, const PickerPropValue &propertyValue) {
+      builder.SetProp(propertyName, propertyValue);
+    });
+
+    stats.plans.fetch_add(1, std::memory_order_relaxed);
+    return builder.Changes();
+  }
+
+  /// <summary>
+  /// Executes a plan on the control's thread. Changes it causes are not reported.
+  /// </summary>
+  void Apply(const TimeApplyPlan &plan, ITimeControl &control, PickerApplyStats &stats = SharedApplyStats()) {
+    ScopedApplyTimer timer{stats};
+    m_updating = true;
+    ApplyPlan(plan, control);
+    m_updating = false;
+  }
+
+  /// <summary>
+  /// Builds and applies a plan in one step, for callers already on the control's thread.
+  /// </summary>
+  void UpdateProps(const IPickerPropReader &props, ITimeControl &control) {
+    Apply(BuildPlan(props), control);
+  }
+
+  /// <summary>
+  /// Handles a time picked in the control. Changes made by Apply are not reported.
+  /// </summary>
+  void OnTimeChanged(int64_t millisecondsSinceMidnight, IPickerEventEmitter &emitter) {
+    if (!m_updating) {
+      emitter.EmitChange(m_anchor.TodayAt(millisecondsSinceMidnight));
+    }
+  }
+
+private:
+  const DayAnchor &m_anchor;
+  bool m_updating{false};
+};
+
+} // namespace winrt::DateTimePicker::Helpers
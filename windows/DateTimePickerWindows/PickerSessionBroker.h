@@ -0,0 +1,465 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Coroutine plumbing for the imperative open/dismiss API. A PickerSession is awaited by the
+// module's open coroutine and settles exactly once: selected, dismissed, timed out or cancelled
+// by a newer open with the same id. Sessions move through an atomic state machine, so the JS thread, the UI
+// thread and timer threads settle them without locks. Header-only and free of WinRT
+// dependencies; the module supplies a dispatcher over the React UI dispatcher, tests supply a
+// fake one.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Thread a session resumes its awaiter on, and a source of timers.
+/// </summary>
+class IPickerDispatcher {
+public:
+  virtual ~IPickerDispatcher() = default;
+
+  /// <summary>
+  /// Runs the callback on the dispatcher thread, after the callbacks already posted.
+  /// </summary>
+  virtual void Post(std::function<void()> callback) = 0;
+
+  /// <summary>
+  /// Runs the callback on any thread once the delay has elapsed.
+  /// </summary>
+  virtual void PostDelayed(std::chrono::milliseconds delay, std::function<void()> callback) = 0;
+};
+
+/// <summary>
+/// Lifecycle of a session: Opening -> Open -> Resolving -> Idle. Any of Opening and Open may
+/// skip straight to Resolving when the session is settled early.
+/// </summary>
+enum class PickerSessionState : int32_t {
+  Idle,      // finished; the picker is free for the next session
+  Opening,   // created; the picker is being configured and shown on the UI thread
+  Open,      // the picker is on screen and waiting for the user
+  Resolving, // an outcome won; the UI thread has yet to release the picker
+};
+
+/// <summary>
+/// Id of an open request, chosen by the caller. Opens without one share id 0.
+/// </summary>
+using PickerSessionId = int64_t;
+
+enum class PickerSessionOutcome : int32_t {
+  Selected,
+  Dismissed,
+  TimedOut,
+  Cancelled, // replaced by a newer open
+};
+
+/// <summary>
+/// Process-wide session counters, including the latency from open to the picker being shown.
+/// </summary>
+struct PickerSessionStats {
+  std::atomic<int64_t> opened{0};
+  std::atomic<int64_t> selected{0};
+  std::atomic<int64_t> dismissed{0};
+  std::atomic<int64_t> timedOut{0};
+  std::atomic<int64_t> cancelled{0};
+  std::atomic<int64_t> shown{0};
+  std::atomic<int64_t> shownNanoseconds{0};
+  std::atomic<int64_t> maxShownNanoseconds{0};
+  std::atomic<int64_t> active{0};    // sessions currently pending, over all modules
+  std::atomic<int64_t> maxActive{0};
+
+  void RecordOutcome(PickerSessionOutcome outcome) noexcept {
+    switch (outcome) {
+      case PickerSessionOutcome::Selected:
+        selected.fetch_add(1, std::memory_order_relaxed);
+        break;
+      case PickerSessionOutcome::Dismissed:
+        dismissed.fetch_add(1, std::memory_order_relaxed);
+        break;
+      case PickerSessionOutcome::TimedOut:
+        timedOut.fetch_add(1, std::memory_order_relaxed);
+        break;
+      case PickerSessionOutcome::Cancelled:
+        cancelled.fetch_add(1, std::memory_order_relaxed);
+        break;
+    }
+  }
+
+  void RecordActive(int64_t delta) noexcept {
+    const int64_t current = active.fetch_add(delta, std::memory_order_relaxed) + delta;
+    int64_t previous = maxActive.load(std::memory_order_relaxed);
+    while (previous < current && !maxActive.compare_exchange_weak(previous, current, std::memory_order_relaxed)) {
+    }
+  }
+
+  void RecordShown(int64_t nanoseconds) noexcept {
+    shown.fetch_add(1, std::memory_order_relaxed);
+    shownNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    int64_t previous = maxShownNanoseconds.load(std::memory_order_relaxed);
+    while (previous < nanoseconds &&
+           !maxShownNanoseconds.compare_exchange_weak(previous, nanoseconds, std::memory_order_relaxed)) {
+    }
+  }
+};
+
+inline PickerSessionStats &SharedPickerSessionStats() noexcept {
+  static PickerSessionStats stats;
+  return stats;
+}
+
+/// <summary>
+/// Return type of fire-and-forget coroutines, such as a module's open flow. The coroutine
+/// starts eagerly and frees itself when it finishes.
+/// </summary>
+struct PickerTask {
+  struct promise_type {
+    PickerTask get_return_object() noexcept {
+      return {};
+    }
+    std::suspend_never initial_suspend() noexcept {
+      return {};
+    }
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept {
+      std::terminate();
+    }
+  };
+};
+
+/// <summary>
+/// Awaitable that continues the coroutine on the dispatcher thread.
+/// </summary>
+class ResumeOn {
+public:
+  explicit ResumeOn(IPickerDispatcher &dispatcher) noexcept : m_dispatcher(dispatcher) {}
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  void await_suspend(std::coroutine_handle<> handle) {
+    m_dispatcher.Post([handle]() { handle.resume(); });
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  IPickerDispatcher &m_dispatcher;
+};
+
+/// <summary>
+/// One open request. Resolve() may be called from any thread and only the first call wins;
+/// the awaiting coroutine is resumed on the dispatcher thread with that outcome and value.
+/// </summary>
+template <typename TValue>
+class PickerSession {
+public:
+  struct Result {
+    PickerSessionOutcome outcome;
+    std::optional<TValue> value;
+  };
+
+  PickerSession(PickerSessionId id, IPickerDispatcher &dispatcher, PickerSessionStats &stats) noexcept
+      : m_id(id), m_dispatcher(dispatcher), m_stats(stats), m_openedAt(std::chrono::steady_clock::now()) {}
+
+  PickerSession(const PickerSession &) = delete;
+  PickerSession &operator=(const PickerSession &) = delete;
+
+  PickerSessionId Id() const noexcept {
+    return m_id;
+  }
+
+  PickerSessionState State() const noexcept {
+    return m_state.load(std::memory_order_acquire);
+  }
+
+  /// <summary>
+  /// Settles the session: moves Opening or Open to Resolving, publishes the result and
+  /// schedules the awaiter.
+  /// </summary>
+  /// <returns>False when the session had already settled</returns>
+  bool Resolve(PickerSessionOutcome outcome, std::optional<TValue> value = std::nullopt) {
+    auto state = m_state.load(std::memory_order_acquire);
+    do {
+      if (state != PickerSessionState::Opening && state != PickerSessionState::Open) {
+        return false;
+      }
+    } while (!m_state.compare_exchange_weak(state, PickerSessionState::Resolving, std::memory_order_acq_rel));
+
+    // Only the winning thread gets here, and nobody reads the result until it is published
+    m_result = Result{outcome, std::move(value)};
+    m_stats.RecordOutcome(outcome);
+
+    if (void *awaiter = m_awaiter.exchange(PublishedMarker(), std::memory_order_acq_rel)) {
+      m_dispatcher.Post([awaiter]() { std::coroutine_handle<>::from_address(awaiter).resume(); });
+    }
+    return true;
+  }
+
+  bool IsResolved() const noexcept {
+    const auto state = State();
+    return state == PickerSessionState::Resolving || state == PickerSessionState::Idle;
+  }
+
+  /// <summary>
+  /// Moves Opening to Open once the picker is on screen, and records the time since the
+  /// session was created as its open-to-shown latency.
+  /// </summary>
+  /// <returns>False when the session settled before the picker was shown; nothing is recorded then</returns>
+  bool MarkOpen() noexcept {
+    const auto elapsed = std::chrono::steady_clock::now() - m_openedAt;
+
+    auto expected = PickerSessionState::Opening;
+    if (!m_state.compare_exchange_strong(expected, PickerSessionState::Open, std::memory_order_acq_rel)) {
+      return false;
+    }
+    m_stats.RecordShown(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    return true;
+  }
+
+  /// <summary>
+  /// Moves Resolving to Idle once the UI thread has released the picker.
+  /// </summary>
+  void Close() noexcept {
+    auto expected = PickerSessionState::Resolving;
+    m_state.compare_exchange_strong(expected, PickerSessionState::Idle, std::memory_order_acq_rel);
+  }
+
+  /// <summary>
+  /// Waits for the outcome. Continues inline when the session has already settled, otherwise
+  /// on the dispatcher thread. Only one coroutine may await a session.
+  /// </summary>
+  auto operator co_await() noexcept {
+    struct Awaiter {
+      PickerSession &session;
+
+      bool await_ready() const noexcept {
+        return session.m_awaiter.load(std::memory_order_acquire) == session.PublishedMarker();
+      }
+
+      bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        // Fails only when Resolve() published in the meantime; then continue without suspending
+        void *expected = nullptr;
+        return session.m_awaiter.compare_exchange_strong(expected, handle.address(), std::memory_order_acq_rel);
+      }
+
+      Result await_resume() const {
+        return *session.m_result;
+      }
+    };
+    return Awaiter{*this};
+  }
+
+private:
+  // Stored in m_awaiter once the result is published; never a coroutine frame address
+  void *PublishedMarker() noexcept {
+    return this;
+  }
+
+  const PickerSessionId m_id;
+  IPickerDispatcher &m_dispatcher;
+  PickerSessionStats &m_stats;
+  const std::chrono::steady_clock::time_point m_openedAt;
+
+  std::atomic<PickerSessionState> m_state{PickerSessionState::Opening};
+  std::atomic<void *> m_awaiter{nullptr}; // suspended coroutine, or the published marker
+  std::optional<Result> m_result;
+};
+
+/// <summary>
+/// Number of sessions a broker keeps open at once unless configured otherwise.
+/// </summary>
+constexpr size_t kDefaultMaxPickerSessions = 8;
+
+/// <summary>
+/// Process-wide cap on concurrent sessions per module; 0 selects kDefaultMaxPickerSessions.
+/// Read when a module is initialized.
+/// </summary>
+inline std::atomic<uint32_t> &MaxPickerSessionsSetting() noexcept {
+  static std::atomic<uint32_t> maxSessions{0};
+  return maxSessions;
+}
+
+/// <summary>
+/// Hands out the sessions of a module, keyed by the id of the open request. Sessions with
+/// different ids run side by side; a new open with an id already in use cancels that session,
+/// and one beyond the cap cancels the oldest, so every promise settles.
+/// </summary>
+template <typename TValue>
+class PickerSessionBroker {
+public:
+  using Session = PickerSession<TValue>;
+
+  explicit PickerSessionBroker(IPickerDispatcher &dispatcher, PickerSessionStats &stats = SharedPickerSessionStats()) noexcept
+      : m_dispatcher(dispatcher), m_stats(stats) {}
+
+  /// <summary>
+  /// Starts a session, cancelling the one it replaces. With a timeout, the session settles as
+  /// TimedOut unless something else settles it first.
+  /// </summary>
+  std::shared_ptr<Session> Begin(PickerSessionId id, std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
+    auto session = std::make_shared<Session>(id, m_dispatcher, m_stats);
+    m_stats.opened.fetch_add(1, std::memory_order_relaxed);
+
+    std::shared_ptr<Session> replaced;
+    {
+      std::lock_guard<std::mutex> lock{m_sessionsMutex};
+      auto entry = Find(id);
+      if (entry != m_sessions.end() && entry->id == id) {
+        replaced = std::exchange(entry->session, session);
+        entry->sequence = ++m_sequence;
+      } else {
+        if (m_sessions.size() >= m_maxSessions) {
+          auto oldest = std::min_element(m_sessions.begin(), m_sessions.end(), [](const auto &left, const auto &right) {
+            return left.sequence < right.sequence;
+          });
+          replaced = std::move(oldest->session);
+          m_sessions.erase(oldest);
+          m_stats.RecordActive(-1);
+        }
+        m_sessions.insert(Find(id), Entry{id, ++m_sequence, session});
+        m_stats.RecordActive(1);
+      }
+    }
+
+    if (replaced) {
+      replaced->Resolve(PickerSessionOutcome::Cancelled);
+    }
+
+    if (timeout) {
+      m_dispatcher.PostDelayed(*timeout, [weakSession = std::weak_ptr<Session>{session}]() {
+        if (auto expired = weakSession.lock()) {
+          expired->Resolve(PickerSessionOutcome::TimedOut);
+        }
+      });
+    }
+    return session;
+  }
+
+  /// <summary>
+  /// Settles the session with the given id as Dismissed.
+  /// </summary>
+  /// <returns>False when no session with that id was pending</returns>
+  bool Dismiss(PickerSessionId id) {
+    std::shared_ptr<Session> session;
+    {
+      std::lock_guard<std::mutex> lock{m_sessionsMutex};
+      auto entry = Find(id);
+      if (entry == m_sessions.end() || entry->id != id) {
+        return false;
+      }
+      session = std::move(entry->session);
+      m_sessions.erase(entry);
+      m_stats.RecordActive(-1);
+    }
+    return session->Resolve(PickerSessionOutcome::Dismissed);
+  }
+
+  /// <summary>
+  /// Settles every pending session as Dismissed.
+  /// </summary>
+  /// <returns>Number of sessions dismissed</returns>
+  size_t DismissAll() {
+    std::vector<Entry> sessions;
+    {
+      std::lock_guard<std::mutex> lock{m_sessionsMutex};
+      sessions.swap(m_sessions);
+      m_stats.RecordActive(-static_cast<int64_t>(sessions.size()));
+    }
+
+    size_t dismissed = 0;
+    for (const auto &entry : sessions) {
+      dismissed += entry.session->Resolve(PickerSessionOutcome::Dismissed) ? 1 : 0;
+    }
+    return dismissed;
+  }
+
+  /// <summary>
+  /// Drops a finished session so its id can be reused.
+  /// </summary>
+  void End(const std::shared_ptr<Session> &session) {
+    std::lock_guard<std::mutex> lock{m_sessionsMutex};
+    auto entry = Find(session->Id());
+    if (entry != m_sessions.end() && entry->session == session) {
+      m_sessions.erase(entry);
+      m_stats.RecordActive(-1);
+    }
+  }
+
+  /// <summary>
+  /// State of the session with the given id; Idle when there is none.
+  /// </summary>
+  PickerSessionState State(PickerSessionId id) const {
+    std::shared_ptr<Session> session;
+    {
+      std::lock_guard<std::mutex> lock{m_sessionsMutex};
+      auto entry = Find(id);
+      if (entry != m_sessions.end() && entry->id == id) {
+        session = entry->session;
+      }
+    }
+    return session ? session->State() : PickerSessionState::Idle;
+  }
+
+  size_t ActiveSessions() const {
+    std::lock_guard<std::mutex> lock{m_sessionsMutex};
+    return m_sessions.size();
+  }
+
+  size_t MaxSessions() const noexcept {
+    return m_maxSessions;
+  }
+
+  /// <summary>
+  /// Sets the number of sessions kept at once; 0 restores the default. Applies to later opens.
+  /// </summary>
+  void MaxSessions(size_t maxSessions) noexcept {
+    m_maxSessions = maxSessions == 0 ? kDefaultMaxPickerSessions : maxSessions;
+  }
+
+private:
+  struct Entry {
+    PickerSessionId id;
+    uint64_t sequence; // order of the opens, to find the oldest session
+    std::shared_ptr<Session> session;
+  };
+
+  // First entry whose id is not less than the given one; the entries are sorted by id
+  auto Find(PickerSessionId id) const {
+    return std::lower_bound(
+        m_sessions.begin(), m_sessions.end(), id, [](const Entry &entry, PickerSessionId value) { return entry.id < value; });
+  }
+
+  auto Find(PickerSessionId id) {
+    return m_sessions.begin() + (std::as_const(*this).Find(id) - m_sessions.cbegin());
+  }
+
+  IPickerDispatcher &m_dispatcher;
+  PickerSessionStats &m_stats;
+  std::atomic<size_t> m_maxSessions{kDefaultMaxPickerSessions};
+
+  // Only guards the map; sessions settle outside it through their own state. A few sessions
+  // at most, so a sorted vector beats a node-based map.
+  mutable std::mutex m_sessionsMutex;
+  std::vector<Entry> m_sessions;
+  uint64_t m_sequence{0};
+};
+
+} // namespace winrt::DateTimePicker::Helpers
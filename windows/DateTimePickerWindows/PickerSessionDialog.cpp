@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PickerSessionDialog.h"
+
+#include <winrt/Microsoft.UI.h>
+#include <winrt/Microsoft.UI.Content.h>
+#include <winrt/Microsoft.UI.Interop.h>
+#include <winrt/Microsoft.UI.Xaml.Media.h>
+
+namespace winrt::DateTimePicker::Helpers {
+
+PickerSessionDialog::PickerSessionDialog(
+    winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+    winrt::Microsoft::UI::Xaml::UIElement const &control,
+    std::function<void()> onShown,
+    std::function<void()> onClosed) noexcept
+    : m_onShown(std::move(onShown)), m_onClosed(std::move(onClosed)) {
+  namespace xaml = winrt::Microsoft::UI::Xaml;
+
+  try {
+    const auto hwnd = reinterpret_cast<HWND>(
+        winrt::Microsoft::ReactNative::ReactCoreInjection::GetTopLevelWindowId(properties));
+    if (!hwnd) {
+      throw winrt::hresult_error{E_NOT_VALID_STATE};
+    }
+
+    m_dialog = xaml::Controls::ContentDialog{};
+    m_dialog.Content(control);
+    m_dialog.CloseButtonText(L"Cancel");
+    m_dialog.DefaultButton(xaml::Controls::ContentDialogButton::None);
+
+    // The dialog draws its own smoke layer; the root only has to let it through
+    m_root = xaml::Controls::Grid{};
+    m_root.Background(xaml::Media::SolidColorBrush{winrt::Microsoft::UI::Colors::Transparent()});
+
+    // A ContentDialog needs a XamlRoot, which the root only has once it is loaded
+    m_rootLoadedRevoker = m_root.Loaded(winrt::auto_revoke, [this](auto &&, auto &&) {
+      m_rootLoadedRevoker.revoke();
+      ShowDialog();
+    });
+
+    RECT clientRect{};
+    ::GetClientRect(hwnd, &clientRect);
+
+    m_source = xaml::Hosting::DesktopWindowXamlSource{};
+    m_source.Initialize(winrt::Microsoft::UI::GetWindowIdFromWindow(hwnd));
+    auto siteBridge = m_source.SiteBridge();
+    siteBridge.ResizePolicy(winrt::Microsoft::UI::Content::ContentSizePolicy::ResizeContentToParentWindow);
+    siteBridge.MoveAndResize({0, 0, clientRect.right - clientRect.left, clientRect.bottom - clientRect.top});
+    m_source.Content(m_root);
+    siteBridge.Show();
+  } catch (const winrt::hresult_error &) {
+    // Without a window to show it over, the session settles as dismissed instead of waiting
+    // for its timeout
+    const auto onClosed = std::move(m_onClosed);
+    Close();
+    onClosed();
+  }
+}
+
+void PickerSessionDialog::ShowDialog() {
+  m_openedRevoker = m_dialog.Opened(winrt::auto_revoke, [this](auto &&, auto &&) {
+    if (m_onShown) {
+      m_onShown();
+    }
+  });
+  m_closedRevoker = m_dialog.Closed(winrt::auto_revoke, [this](auto &&, auto &&) {
+    // Invoked through a copy: the callback may settle the session and lead to Close()
+    if (const auto onClosed = m_onClosed) {
+      onClosed();
+    }
+  });
+
+  try {
+    m_dialog.XamlRoot(m_root.XamlRoot());
+    m_dialog.ShowAsync();
+  } catch (const winrt::hresult_error &) {
+    if (const auto onClosed = m_onClosed) {
+      onClosed();
+    }
+  }
+}
+
+void PickerSessionDialog::Close() noexcept {
+  m_rootLoadedRevoker.revoke();
+  m_openedRevoker.revoke();
+  m_closedRevoker.revoke();
+  m_onShown = nullptr;
+  m_onClosed = nullptr;
+
+  try {
+    if (m_dialog) {
+      m_dialog.Hide();
+      m_dialog.Content(nullptr);
+    }
+    if (m_source) {
+      m_source.Content(nullptr);
+      m_source.Close();
+    }
+  } catch (const winrt::hresult_error &) {
+  }
+  m_dialog = nullptr;
+  m_root = nullptr;
+  m_source = nullptr;
+}
+
+PickerSessionDialog::~PickerSessionDialog() noexcept {
+  Close();
+}
+
+} // namespace winrt::DateTimePicker::Helpers
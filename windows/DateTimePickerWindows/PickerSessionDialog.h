@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "NativeModules.h"
+
+#include <winrt/Microsoft.UI.Xaml.Controls.h>
+#include <winrt/Microsoft.UI.Xaml.Hosting.h>
+
+#include <functional>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Shows the control of an imperative picker session in a ContentDialog over the top-level
+/// window of the React instance. The dialog lives in its own XAML source, sized to that window,
+/// so sessions never depend on a mounted picker view. UI thread only.
+/// </summary>
+class PickerSessionDialog {
+public:
+  /// <summary>
+  /// Starts showing the dialog. onShown runs once it is on screen; onClosed runs when the user
+  /// closes it, or right away when it cannot be shown.
+  /// </summary>
+  PickerSessionDialog(
+      winrt::Microsoft::ReactNative::IReactPropertyBag const &properties,
+      winrt::Microsoft::UI::Xaml::UIElement const &control,
+      std::function<void()> onShown,
+      std::function<void()> onClosed) noexcept;
+
+  /// <summary>
+  /// Hides the dialog, if still open, and takes the control out of it so it can be pooled.
+  /// onShown and onClosed are not called afterwards.
+  /// </summary>
+  void Close() noexcept;
+
+  ~PickerSessionDialog() noexcept;
+
+  PickerSessionDialog(const PickerSessionDialog &) = delete;
+  PickerSessionDialog &operator=(const PickerSessionDialog &) = delete;
+
+private:
+  void ShowDialog();
+
+  winrt::Microsoft::UI::Xaml::Hosting::DesktopWindowXamlSource m_source{nullptr};
+  winrt::Microsoft::UI::Xaml::Controls::Grid m_root{nullptr};
+  winrt::Microsoft::UI::Xaml::Controls::ContentDialog m_dialog{nullptr};
+  winrt::Microsoft::UI::Xaml::FrameworkElement::Loaded_revoker m_rootLoadedRevoker;
+  winrt::Microsoft::UI::Xaml::Controls::ContentDialog::Opened_revoker m_openedRevoker;
+  winrt::Microsoft::UI::Xaml::Controls::ContentDialog::Closed_revoker m_closedRevoker;
+  std::function<void()> m_onShown;
+  std::function<void()> m_onClosed;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "InstancePool.h"
+#include "PickerSessionBroker.h"
+#include "PickerWindow.h"
+
+#include <memory>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Component counters of the imperative pickers, summed over both modules.
+/// </summary>
+inline InstancePoolMetrics &SharedSessionComponentMetrics() noexcept {
+  static InstancePoolMetrics metrics;
+  return metrics;
+}
+
+/// <summary>
+/// Everything an imperative picker module shares with its in-flight open coroutines. Each
+/// coroutine holds a reference, so a module torn down on reload cannot leave one resuming into
+/// freed state, and the last reference is dropped on the UI thread, which owns the components.
+/// Every session takes its own component from the pool and returns it once settled.
+/// </summary>
+template <typename TComponent, typename TSelection>
+struct PickerSessionHost {
+  explicit PickerSessionHost(std::shared_ptr<PickerWindow> pickerWindow) noexcept : window(std::move(pickerWindow)) {
+    sessions.MaxSessions(MaxPickerSessionsSetting().load(std::memory_order_relaxed));
+  }
+
+  // Sessions resume on the UI dispatcher of the module's window
+  const std::shared_ptr<PickerWindow> window;
+  IPickerDispatcher &dispatcher{window->dispatcher};
+  PickerSessionBroker<TSelection> sessions{dispatcher};
+
+  // UI thread only. Holds as many components as sessions may be open at once.
+  InstancePool<std::unique_ptr<TComponent>> components{
+      sessions.MaxSessions(),
+      []() { return std::make_unique<TComponent>(); },
+      [](std::unique_ptr<TComponent> &component) {
+        component->Reset();
+        return true;
+      },
+      SharedSessionComponentMetrics()};
+
+  /// <summary>
+  /// Dismisses the pending sessions and hands the last module reference to the UI thread, so
+  /// the components are destroyed there, after the dismissed sessions have returned them.
+  /// </summary>
+  static void Release(std::shared_ptr<PickerSessionHost> host) noexcept {
+    if (!host) {
+      return;
+    }
+
+    try {
+      host->sessions.DismissAll();
+      auto &uiDispatcher = host->dispatcher;
+      uiDispatcher.Post([host = std::move(host)]() mutable { host.reset(); });
+    } catch (...) {
+      // The UI dispatcher is already shut down; nothing is left to run the components on
+    }
+  }
+};
+
+} // namespace winrt::DateTimePicker::Helpers
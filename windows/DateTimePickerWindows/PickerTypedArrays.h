@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// The views are portable; only the functions that make them need JSI
+#if __has_include(<JSI/JsiApiContext.h>)
+#include <JSI/JsiApiContext.h>
+#endif
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <variant>
+
+namespace winrt::DateTimePicker {
+
+/// <summary>
+/// The elements of a Float64Array or BigInt64Array, viewed in place in the array's buffer.
+/// </summary>
+using TimestampArray = std::variant<std::span<double>, std::span<int64_t>>;
+
+#if __has_include(<JSI/JsiApiContext.h>)
+
+/// <summary>
+/// Views a Float64Array or BigInt64Array without copying it. Returns nullopt for anything
+/// else, including plain arrays, which go through the TurboModule instead.
+/// </summary>
+inline std::optional<TimestampArray> TimestampArrayFrom(facebook::jsi::Runtime &runtime, const facebook::jsi::Value &value) {
+  if (!value.isObject()) {
+    return std::nullopt;
+  }
+
+  const auto object = value.getObject(runtime);
+  const auto global = runtime.global();
+  const bool isFloat64 = object.instanceOf(runtime, global.getPropertyAsFunction(runtime, "Float64Array"));
+  const bool isBigInt64 = !isFloat64 && global.hasProperty(runtime, "BigInt64Array") &&
+      object.instanceOf(runtime, global.getPropertyAsFunction(runtime, "BigInt64Array"));
+  if (!isFloat64 && !isBigInt64) {
+    return std::nullopt;
+  }
+
+  const auto buffer = object.getPropertyAsObject(runtime, "buffer");
+  if (!buffer.isArrayBuffer(runtime)) {
+    return std::nullopt;
+  }
+
+  // Typed arrays are aligned to their element size within the buffer
+  uint8_t *data = buffer.getArrayBuffer(runtime).data(runtime) +
+      static_cast<size_t>(object.getProperty(runtime, "byteOffset").asNumber());
+  const auto length = static_cast<size_t>(object.getProperty(runtime, "length").asNumber());
+  if (isFloat64) {
+    return TimestampArray{std::span<double>{reinterpret_cast<double *>(data), length}};
+  }
+  return TimestampArray{std::span<int64_t>{reinterpret_cast<int64_t *>(data), length}};
+}
+
+/// <summary>
+/// Creates a Float64Array of the given length and returns it with a view of its elements.
+/// </summary>
+inline std::pair<facebook::jsi::Object, std::span<double>> NewFloat64Array(facebook::jsi::Runtime &runtime, size_t length) {
+  auto array = runtime.global()
+                   .getPropertyAsFunction(runtime, "Float64Array")
+                   .callAsConstructor(runtime, static_cast<double>(length))
+                   .getObject(runtime);
+  auto buffer = array.getPropertyAsObject(runtime, "buffer").getArrayBuffer(runtime);
+  const std::span<double> elements{reinterpret_cast<double *>(buffer.data(runtime)), length};
+  return {std::move(array), elements};
+}
+#endif
+
+} // namespace winrt::DateTimePicker
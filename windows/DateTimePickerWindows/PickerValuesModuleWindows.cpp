@@ -0,0 +1,346 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PickerValuesModuleWindows.h"
+#include "EventQueue.h"
+#include "OffscreenUpdates.h"
+#include "PickerApplyPlan.h"
+#include "PickerDateMathJsi.h"
+#include "PickerIslandPool.h"
+#include "PickerSessionHost.h"
+#include "PickerTypedArrays.h"
+#include "PickerWindow.h"
+#include "PickerWarmUpModuleWindows.h"
+
+#include <JSI/JsiApiContext.h>
+
+#include <limits>
+
+namespace winrt::DateTimePicker {
+
+namespace {
+
+facebook::jsi::Value ReadPickerValue(const Helpers::PickerValueRegistry &values, const facebook::jsi::Value &tag) {
+  if (!tag.isNumber()) {
+    return facebook::jsi::Value::undefined();
+  }
+
+  const auto value = values.Read(static_cast<int64_t>(tag.asNumber()));
+  return value ? facebook::jsi::Value(static_cast<double>(*value)) : facebook::jsi::Value::undefined();
+}
+
+// Reads the values of the tags in a typed or plain array into a Float64Array, the one passed
+// as second argument when it is long enough, or a new one. Missing values are NaN.
+facebook::jsi::Value ReadPickerValuesArray(facebook::jsi::Runtime &runtime,
+                                           const Helpers::PickerValueRegistry &values,
+                                           const facebook::jsi::Value *args,
+                                           size_t count) {
+  if (count < 1 || !args[0].isObject()) {
+    return facebook::jsi::Value::undefined();
+  }
+
+  const auto readValue = [&](double tag) {
+    const auto value = values.Read(static_cast<int64_t>(tag));
+    return value ? static_cast<double>(*value) : std::numeric_limits<double>::quiet_NaN();
+  };
+
+  const auto tags = TimestampArrayFrom(runtime, args[0]);
+  size_t length = 0;
+  if (tags) {
+    length = std::visit([](auto elements) { return elements.size(); }, *tags);
+  } else if (args[0].getObject(runtime).isArray(runtime)) {
+    length = args[0].getObject(runtime).getArray(runtime).size(runtime);
+  } else {
+    return facebook::jsi::Value::undefined();
+  }
+
+  std::optional<facebook::jsi::Object> result;
+  std::span<double> out;
+  if (count > 1) {
+    if (const auto provided = TimestampArrayFrom(runtime, args[1]);
+        provided && std::holds_alternative<std::span<double>>(*provided) &&
+        std::get<std::span<double>>(*provided).size() >= length) {
+      result = args[1].getObject(runtime);
+      out = std::get<std::span<double>>(*provided);
+    }
+  }
+  if (!result) {
+    auto [array, elements] = NewFloat64Array(runtime, length);
+    result = std::move(array);
+    out = elements;
+  }
+
+  if (tags) {
+    // Viewed again: creating the result may have run the garbage collector
+    std::visit(
+        [&](auto elements) {
+          for (size_t i = 0; i < length; ++i) {
+            out[i] = readValue(static_cast<double>(elements[i]));
+          }
+        },
+        *TimestampArrayFrom(runtime, args[0]));
+  } else {
+    const auto array = args[0].getObject(runtime).getArray(runtime);
+    for (size_t i = 0; i < length; ++i) {
+      const auto tag = array.getValueAtIndex(runtime, i);
+      out[i] = tag.isNumber() ? readValue(tag.asNumber()) : std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+  return facebook::jsi::Value(std::move(*result));
+}
+
+// Installed once per runtime; reads the values of that instance's window only
+class PickerValuesHostObject final : public facebook::jsi::HostObject {
+public:
+  explicit PickerValuesHostObject(std::shared_ptr<PickerWindow> window) noexcept : m_window(std::move(window)) {}
+
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &name) override {
+    const auto propName = name.utf8(runtime);
+
+    if (propName == "getValue") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          1,
+          [window = m_window](facebook::jsi::Runtime & /*runtime*/,
+                              const facebook::jsi::Value & /*thisValue*/,
+                              const facebook::jsi::Value *args,
+                              size_t count) -> facebook::jsi::Value {
+            return count < 1 ? facebook::jsi::Value::undefined() : ReadPickerValue(window->values, args[0]);
+          });
+    }
+
+    if (propName == "getValues") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          1,
+          [window = m_window](facebook::jsi::Runtime &runtime,
+                              const facebook::jsi::Value & /*thisValue*/,
+                              const facebook::jsi::Value *args,
+                              size_t count) -> facebook::jsi::Value {
+            if (count < 1 || !args[0].isObject() || !args[0].getObject(runtime).isArray(runtime)) {
+              return facebook::jsi::Array(runtime, 0);
+            }
+
+            const auto tags = args[0].getObject(runtime).getArray(runtime);
+            const size_t length = tags.size(runtime);
+            facebook::jsi::Array values(runtime, length);
+            for (size_t i = 0; i < length; ++i) {
+              values.setValueAtIndex(runtime, i, ReadPickerValue(window->values, tags.getValueAtIndex(runtime, i)));
+            }
+            return values;
+          });
+    }
+
+    if (propName == "getValuesArray") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          2,
+          [window = m_window](facebook::jsi::Runtime &runtime,
+                              const facebook::jsi::Value & /*thisValue*/,
+                              const facebook::jsi::Value *args,
+                              size_t count) -> facebook::jsi::Value {
+            return ReadPickerValuesArray(runtime, window->values, args, count);
+          });
+    }
+
+    return GetPickerDateMathFunction(runtime, name, propName);
+  }
+
+  std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &runtime) override {
+    auto names = facebook::jsi::PropNameID::names(runtime, "getValue", "getValues", "getValuesArray");
+    for (const auto function : kPickerDateMathFunctions) {
+      names.push_back(facebook::jsi::PropNameID::forUtf8(runtime, std::string{function}));
+    }
+    return names;
+  }
+
+private:
+  std::shared_ptr<PickerWindow> m_window;
+};
+
+// Installed next to the values object; the counters are diagnostics, kept apart from the
+// functions apps call on every frame
+class PickerStatsHostObject final : public facebook::jsi::HostObject {
+public:
+  explicit PickerStatsHostObject(std::shared_ptr<PickerWindow> window) noexcept : m_window(std::move(window)) {}
+
+  facebook::jsi::Value get(facebook::jsi::Runtime &runtime, const facebook::jsi::PropNameID &name) override {
+    const auto propName = name.utf8(runtime);
+
+    if (propName == "getEventQueueStats") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [](facebook::jsi::Runtime &runtime,
+             const facebook::jsi::Value & /*thisValue*/,
+             const facebook::jsi::Value * /*args*/,
+             size_t /*count*/) -> facebook::jsi::Value {
+            const auto &metrics = Helpers::SharedEventQueueMetrics();
+            facebook::jsi::Object stats(runtime);
+            stats.setProperty(runtime, "pending", static_cast<double>(metrics.pending.load()));
+            stats.setProperty(runtime, "maxDepth", static_cast<double>(metrics.maxDepth.load()));
+            stats.setProperty(runtime, "dropped", static_cast<double>(metrics.dropped.load()));
+            stats.setProperty(runtime, "delivered", static_cast<double>(metrics.delivered.load()));
+            return stats;
+          });
+    }
+
+    if (propName == "getApplyStats") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [](facebook::jsi::Runtime &runtime,
+             const facebook::jsi::Value & /*thisValue*/,
+             const facebook::jsi::Value * /*args*/,
+             size_t /*count*/) -> facebook::jsi::Value {
+            const auto &applyStats = Helpers::SharedApplyStats();
+            const auto applies = applyStats.applies.load();
+            facebook::jsi::Object stats(runtime);
+            stats.setProperty(runtime, "plans", static_cast<double>(applyStats.plans.load()));
+            stats.setProperty(runtime, "applies", static_cast<double>(applies));
+            stats.setProperty(
+                runtime,
+                "meanApplyMs",
+                applies == 0 ? 0.0 : static_cast<double>(applyStats.applyNanoseconds.load()) / applies / 1e6);
+            stats.setProperty(runtime, "maxApplyMs", static_cast<double>(applyStats.maxApplyNanoseconds.load()) / 1e6);
+            const auto &offscreenStats = Helpers::SharedOffscreenStats();
+            stats.setProperty(runtime, "offscreenSuspended", static_cast<double>(offscreenStats.suspended.load()));
+            stats.setProperty(runtime, "offscreenResumed", static_cast<double>(offscreenStats.resumed.load()));
+            stats.setProperty(runtime, "deferred", static_cast<double>(offscreenStats.deferred.load()));
+            stats.setProperty(runtime, "collapsed", static_cast<double>(offscreenStats.collapsed.load()));
+            stats.setProperty(runtime, "flushed", static_cast<double>(offscreenStats.flushed.load()));
+            return stats;
+          });
+    }
+
+    if (propName == "getSessionStats") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [](facebook::jsi::Runtime &runtime,
+             const facebook::jsi::Value & /*thisValue*/,
+             const facebook::jsi::Value * /*args*/,
+             size_t /*count*/) -> facebook::jsi::Value {
+            const auto &sessionStats = Helpers::SharedPickerSessionStats();
+            const auto shown = sessionStats.shown.load();
+            facebook::jsi::Object stats(runtime);
+            stats.setProperty(runtime, "opened", static_cast<double>(sessionStats.opened.load()));
+            stats.setProperty(runtime, "selected", static_cast<double>(sessionStats.selected.load()));
+            stats.setProperty(runtime, "dismissed", static_cast<double>(sessionStats.dismissed.load()));
+            stats.setProperty(runtime, "timedOut", static_cast<double>(sessionStats.timedOut.load()));
+            stats.setProperty(runtime, "cancelled", static_cast<double>(sessionStats.cancelled.load()));
+            stats.setProperty(
+                runtime,
+                "meanShownMs",
+                shown == 0 ? 0.0 : static_cast<double>(sessionStats.shownNanoseconds.load()) / shown / 1e6);
+            stats.setProperty(runtime, "maxShownMs", static_cast<double>(sessionStats.maxShownNanoseconds.load()) / 1e6);
+            stats.setProperty(runtime, "active", static_cast<double>(sessionStats.active.load()));
+            stats.setProperty(runtime, "maxActive", static_cast<double>(sessionStats.maxActive.load()));
+            const auto &componentMetrics = Helpers::SharedSessionComponentMetrics();
+            stats.setProperty(runtime, "componentsCreated", static_cast<double>(componentMetrics.misses.load()));
+            stats.setProperty(runtime, "componentsReused", static_cast<double>(componentMetrics.hits.load()));
+            return stats;
+          });
+    }
+
+#if defined(RNW_NEW_ARCH)
+    // Island pools and warm-up only exist for Fabric views
+    if (propName == "getPoolStats") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [](facebook::jsi::Runtime &runtime,
+             const facebook::jsi::Value & /*thisValue*/,
+             const facebook::jsi::Value * /*args*/,
+             size_t /*count*/) -> facebook::jsi::Value {
+            const auto poolStats = GetPickerIslandPoolStats();
+            facebook::jsi::Object stats(runtime);
+            stats.setProperty(runtime, "hits", static_cast<double>(poolStats.hits));
+            stats.setProperty(runtime, "misses", static_cast<double>(poolStats.misses));
+            stats.setProperty(runtime, "returned", static_cast<double>(poolStats.returned));
+            stats.setProperty(runtime, "discarded", static_cast<double>(poolStats.discarded));
+            stats.setProperty(runtime, "warmed", static_cast<double>(poolStats.warmed));
+            return stats;
+          });
+    }
+
+    if (propName == "getWarmUpStats") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [](facebook::jsi::Runtime &runtime,
+             const facebook::jsi::Value & /*thisValue*/,
+             const facebook::jsi::Value * /*args*/,
+             size_t /*count*/) -> facebook::jsi::Value {
+            static constexpr const char *kStateNames[] = {"notRequested", "pending", "completed", "cancelled", "skipped"};
+            const auto warmUpStats = GetPickerWarmUpStats();
+            facebook::jsi::Object stats(runtime);
+            stats.setProperty(runtime, "state", kStateNames[static_cast<int32_t>(warmUpStats.state)]);
+            stats.setProperty(runtime, "busyMs", warmUpStats.busyMilliseconds);
+            stats.setProperty(runtime, "elapsedMs", warmUpStats.elapsedMilliseconds);
+            return stats;
+          });
+    }
+
+    if (propName == "getLocaleStats") {
+      return facebook::jsi::Function::createFromHostFunction(
+          runtime,
+          name,
+          0,
+          [window = m_window](facebook::jsi::Runtime &runtime,
+                              const facebook::jsi::Value & /*thisValue*/,
+                              const facebook::jsi::Value * /*args*/,
+                              size_t /*count*/) -> facebook::jsi::Value {
+            const auto localeStats = window->views.Stats();
+            facebook::jsi::Object stats(runtime);
+            stats.setProperty(runtime, "liveViews", static_cast<double>(window->views.Count()));
+            stats.setProperty(runtime, "batches", static_cast<double>(localeStats.batches));
+            stats.setProperty(runtime, "viewsUpdated", static_cast<double>(localeStats.viewsUpdated));
+            stats.setProperty(runtime, "lastBatchViews", static_cast<double>(localeStats.lastBatchViews));
+            stats.setProperty(runtime, "lastBatchMs", localeStats.lastBatchMilliseconds);
+            stats.setProperty(runtime, "maxBatchMs", localeStats.maxBatchMilliseconds);
+            return stats;
+          });
+    }
+#endif // defined(RNW_NEW_ARCH)
+
+    return facebook::jsi::Value::undefined();
+  }
+
+  std::vector<facebook::jsi::PropNameID> getPropertyNames(facebook::jsi::Runtime &runtime) override {
+#if defined(RNW_NEW_ARCH)
+    return facebook::jsi::PropNameID::names(runtime, "getEventQueueStats", "getApplyStats", "getSessionStats", "getPoolStats", "getWarmUpStats", "getLocaleStats");
+#else
+    return facebook::jsi::PropNameID::names(runtime, "getEventQueueStats", "getApplyStats", "getSessionStats");
+#endif // defined(RNW_NEW_ARCH)
+  }
+
+private:
+  std::shared_ptr<PickerWindow> m_window;
+};
+
+} // anonymous namespace
+
+void PickerValuesModule::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
+  winrt::Microsoft::ReactNative::ExecuteJsi(reactContext, [window = GetPickerWindow(reactContext.Handle())](facebook::jsi::Runtime &runtime) {
+    runtime.global().setProperty(
+        runtime,
+        "__rnDateTimePickerValues",
+        facebook::jsi::Object::createFromHostObject(runtime, std::make_shared<PickerValuesHostObject>(window)));
+    runtime.global().setProperty(
+        runtime,
+        "__rnDateTimePickerStats",
+        facebook::jsi::Object::createFromHostObject(runtime, std::make_shared<PickerStatsHostObject>(window)));
+  });
+}
+
+} // namespace winrt::DateTimePicker
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "NativeModules.h"
+
+namespace winrt::DateTimePicker {
+
+// PickerValuesModule installs the global.__rnDateTimePickerValues JSI host object, which lets
+// JavaScript read the value last committed by a mounted picker synchronously:
+//   global.__rnDateTimePickerValues.getValue(viewTag)  -> number | undefined
+//   global.__rnDateTimePickerValues.getValues([tags])  -> Array<number | undefined>
+//   global.__rnDateTimePickerValues.getValuesArray(tags, out?) -> Float64Array, NaN where missing
+// It also carries the typed-array date math functions (see PickerDateMathJsi.h).
+// Values come from the lock-free snapshot registry that the Fabric views of the same window publish
+// to (see ValueSnapshotRegistry.h and PickerWindow.h).
+//
+// The native counters live on a separate global.__rnDateTimePickerStats host object:
+//   global.__rnDateTimePickerStats.getEventQueueStats() -> {pending, maxDepth, dropped, delivered}
+//   global.__rnDateTimePickerStats.getApplyStats() -> {plans, applies, meanApplyMs, maxApplyMs, ...}
+//   global.__rnDateTimePickerStats.getSessionStats() -> {opened, selected, dismissed, timedOut, cancelled, ...}
+// and, with the new architecture only:
+//   global.__rnDateTimePickerStats.getPoolStats() -> {hits, misses, returned, discarded, warmed}
+//   global.__rnDateTimePickerStats.getWarmUpStats() -> {state, busyMs, elapsedMs}
+//   global.__rnDateTimePickerStats.getLocaleStats() -> {liveViews, batches, viewsUpdated, lastBatchViews, lastBatchMs, maxBatchMs}
+REACT_MODULE(PickerValuesModule)
+struct PickerValuesModule {
+  REACT_INIT(Initialize)
+  void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
+};
+
+} // namespace winrt::DateTimePicker
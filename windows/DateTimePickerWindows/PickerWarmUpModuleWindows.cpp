@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PickerWarmUpModuleWindows.h"
+
+#if defined(RNW_NEW_ARCH)
+
+#include "DateTimeHelpers.h"
+
+#include <winrt/Microsoft.UI.Dispatching.h>
+#include <winrt/Microsoft.UI.Xaml.Controls.h>
+#include <winrt/Windows.Globalization.h>
+
+#include <atomic>
+#include <chrono>
+
+namespace winrt::DateTimePicker {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::atomic<bool> g_warmUpEnabled{false};
+std::atomic<bool> g_pickerMounted{false};
+std::atomic<PickerWarmUpState> g_state{PickerWarmUpState::NotRequested};
+std::atomic<int64_t> g_busyMicroseconds{0};
+std::atomic<int64_t> g_elapsedMicroseconds{0};
+
+// Each step is small enough to run inside one idle callback
+constexpr size_t kStepCount = 4;
+
+void RunStep(size_t step) {
+  switch (step) {
+    case 0:
+      winrt::Microsoft::UI::Xaml::Controls::CalendarDatePicker{};
+      break;
+    case 1:
+      winrt::Microsoft::UI::Xaml::Controls::TimePicker{};
+      break;
+    case 2:
+      winrt::Windows::Globalization::Calendar{}.SetToNow();
+      break;
+    case 3:
+      // Fills the formatter caches lazy pickers use for their placeholders (see DateTimeHelpers.h)
+      Helpers::FormatDate(winrt::clock::now(), L"");
+      Helpers::FormatTime(winrt::Windows::Foundation::TimeSpan{0}, std::nullopt);
+      break;
+  }
+}
+
+void EnqueueStep(winrt::Microsoft::UI::Dispatching::DispatcherQueue const &dispatcherQueue, size_t step, Clock::time_point scheduledAt) {
+  dispatcherQueue.TryEnqueue(
+      winrt::Microsoft::UI::Dispatching::DispatcherQueuePriority::Low, [dispatcherQueue, step, scheduledAt]() {
+        if (g_state.load() != PickerWarmUpState::Pending) {
+          return;
+        }
+
+        const auto start = Clock::now();
+        try {
+          RunStep(step);
+        } catch (const winrt::hresult_error &) {
+        }
+        const auto end = Clock::now();
+        g_busyMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        if (step + 1 < kStepCount) {
+          EnqueueStep(dispatcherQueue, step + 1, scheduledAt);
+          return;
+        }
+
+        g_elapsedMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - scheduledAt).count();
+        auto expected = PickerWarmUpState::Pending;
+        g_state.compare_exchange_strong(expected, PickerWarmUpState::Completed);
+      });
+}
+
+void EndPendingWarmUp(PickerWarmUpState reason) noexcept {
+  auto expected = PickerWarmUpState::Pending;
+  g_state.compare_exchange_strong(expected, reason);
+}
+
+} // anonymous namespace
+
+void PickerWarmUpModule::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
+  auto expected = PickerWarmUpState::NotRequested;
+  if (!g_warmUpEnabled.load() || !g_state.compare_exchange_strong(expected, PickerWarmUpState::Pending)) {
+    return;
+  }
+  if (g_pickerMounted.load()) {
+    EndPendingWarmUp(PickerWarmUpState::Skipped);
+    return;
+  }
+
+  // XAML controls must be created on the UI thread
+  const auto scheduledAt = Clock::now();
+  reactContext.UIDispatcher().Post([scheduledAt]() {
+    if (auto dispatcherQueue = winrt::Microsoft::UI::Dispatching::DispatcherQueue::GetForCurrentThread()) {
+      EnqueueStep(dispatcherQueue, 0, scheduledAt);
+    } else {
+      EndPendingWarmUp(PickerWarmUpState::Cancelled);
+    }
+  });
+}
+
+void EnablePickerWarmUp() noexcept {
+  g_warmUpEnabled.store(true);
+}
+
+void CancelPickerWarmUp() noexcept {
+  EndPendingWarmUp(PickerWarmUpState::Cancelled);
+}
+
+void NotifyPickerMounted() noexcept {
+  g_pickerMounted.store(true);
+  EndPendingWarmUp(PickerWarmUpState::Skipped);
+}
+
+PickerWarmUpStats GetPickerWarmUpStats() noexcept {
+  return PickerWarmUpStats{
+      g_state.load(), g_busyMicroseconds.load() / 1000.0, g_elapsedMicroseconds.load() / 1000.0};
+}
+
+} // namespace winrt::DateTimePicker
+
+#endif // defined(RNW_NEW_ARCH)
@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#if defined(RNW_NEW_ARCH)
+
+#include "NativeModules.h"
+
+#include <cstdint>
+
+namespace winrt::DateTimePicker {
+
+// PickerWarmUpModule pays the one-time costs of the first picker ahead of time: XAML type loading and
+// resource resolution for CalendarDatePicker and TimePicker, and Windows.Globalization calendar and
+// formatter setup. The work runs on the UI thread at idle priority, one step per callback, and stops
+// as soon as a picker mounts or CancelPickerWarmUp() is called. Opt-in through ReactPackageProvider::WarmUpPickers.
+REACT_MODULE(PickerWarmUpModule)
+struct PickerWarmUpModule {
+  REACT_INIT(Initialize)
+  void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
+};
+
+enum class PickerWarmUpState : int32_t {
+  NotRequested,
+  Pending,
+  Completed,
+  Cancelled,
+  Skipped, // a picker mounted before the warm-up finished
+};
+
+struct PickerWarmUpStats {
+  PickerWarmUpState state;
+  double busyMilliseconds;    // time spent in warm-up steps
+  double elapsedMilliseconds; // from scheduling to completion
+};
+
+// Requests warm-up for instances created after this call. Called from ReactPackageProvider::CreatePackage.
+void EnablePickerWarmUp() noexcept;
+
+// Stops a pending warm-up before its next step.
+void CancelPickerWarmUp() noexcept;
+
+// Called by picker views when they mount; the warm-up no longer helps once a picker exists.
+void NotifyPickerMounted() noexcept;
+
+PickerWarmUpStats GetPickerWarmUpStats() noexcept;
+
+} // namespace winrt::DateTimePicker
+
+#endif // defined(RNW_NEW_ARCH)
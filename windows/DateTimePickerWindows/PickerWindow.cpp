@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "pch.h"
+#include "PickerWindow.h"
+#include "DateTimeHelpers.h"
+#include "DayAnchor.h"
+#include "PickerIslandPool.h"
+
+namespace winrt::DateTimePicker {
+
+namespace {
+
+Helpers::PickerWindowRegistryStats g_windowStats;
+
+Helpers::PickerWindowRegistry<PickerWindow> &PickerWindows() noexcept {
+  static Helpers::PickerWindowRegistry<PickerWindow> registry{g_windowStats};
+  return registry;
+}
+
+// Id of the instance's window, kept in the instance properties. Ids are never reused, so the
+// registry cannot hand a later instance the window of one that was torn down.
+const winrt::Microsoft::ReactNative::ReactPropertyId<int64_t> &WindowIdProperty() noexcept {
+  static const winrt::Microsoft::ReactNative::ReactPropertyId<int64_t> property{L"DateTimePicker", L"PickerWindowId"};
+  return property;
+}
+
+#if defined(RNW_NEW_ARCH)
+// Pooled controls belong to the instance's UI thread, so they are released there when the
+// instance goes away instead of at thread exit, when XAML may already be shut down
+void ClearIslandPoolsOnInstanceDestroyed(winrt::Microsoft::ReactNative::IReactContext const &reactContext) {
+  reactContext.Notifications().Subscribe(
+      winrt::Microsoft::ReactNative::ReactInstanceSettings::InstanceDestroyedNotification(),
+      reactContext.UIDispatcher(),
+      [](winrt::Windows::Foundation::IInspectable const & /*sender*/,
+         winrt::Microsoft::ReactNative::IReactNotificationArgs const &args) {
+        args.Subscription().Unsubscribe();
+        ClearPickerIslandPools();
+      });
+}
+#endif
+
+} // anonymous namespace
+
+std::shared_ptr<PickerWindow> GetPickerWindow(winrt::Microsoft::ReactNative::IReactContext const &reactContext) {
+  const winrt::Microsoft::ReactNative::ReactPropertyBag properties{reactContext.Properties()};
+  const auto windowId = *properties.GetOrCreate(WindowIdProperty(), []() { return PickerWindows().NewWindowId(); });
+
+  return PickerWindows().Get(windowId, [&]() {
+#if defined(RNW_NEW_ARCH)
+    ClearIslandPoolsOnInstanceDestroyed(reactContext);
+#endif
+    return std::make_shared<PickerWindow>(windowId, reactContext.UIDispatcher());
+  });
+}
+
+void BroadcastTimeZoneOrLocaleChange() noexcept {
+  // Shared by all windows, so invalidated once before any view is refreshed
+  Helpers::NotifyTimeZoneChanged();
+  Helpers::ResetFormatters();
+
+  try {
+    PickerWindows().PostToLiveWindows([](PickerWindow &window) { window.views.RefreshAll(); });
+  } catch (...) {
+    // Out of memory listing the windows; their views refresh with their next props
+  }
+}
+
+} // namespace winrt::DateTimePicker
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "EventBatcher.h"
+#include "JSValue.h"
+#include "LivePickerViews.h"
+#include "NativeModules.h"
+#include "PickerWindowRegistry.h"
+#include "ReactPickerDispatcher.h"
+#include "ValueSnapshotRegistry.h"
+
+#include <memory>
+
+namespace winrt::DateTimePicker {
+
+using PickerEventBatcher = Helpers::EventBatcher<winrt::Microsoft::ReactNative::JSValueObject>;
+
+// State shared by the pickers of one window, that is one React instance and its UI thread.
+// Views, imperative sessions and the JSI host object of a window bind to it when they are
+// created, so windows never share a dispatcher, value registry or event batcher.
+struct PickerWindow {
+  PickerWindow(Helpers::PickerWindowId windowId, winrt::Microsoft::ReactNative::IReactDispatcher uiDispatcher) noexcept
+      : id(windowId), dispatcher(std::move(uiDispatcher)) {}
+
+  const Helpers::PickerWindowId id;
+
+  // The window's UI dispatcher; controls of this window are created and released on it
+  Helpers::ReactPickerDispatcher dispatcher;
+
+  // Values committed by this window's views, read by this instance's JS runtime. Tags are
+  // only unique within an instance, so every window keeps its own.
+  Helpers::PickerValueRegistry values;
+
+  // Mounted Fabric views, refreshed together when the time zone or languages change
+  Helpers::LivePickerViews views;
+
+  // Set by PickerEventBatchModule when batching is enabled; read with std::atomic_load
+  std::shared_ptr<PickerEventBatcher> batcher;
+};
+
+// Window of the React instance the context belongs to, created on first use. Cheap on the
+// thread that last asked for the same window; call it when a view or module is set up and keep
+// the result.
+std::shared_ptr<PickerWindow> GetPickerWindow(winrt::Microsoft::ReactNative::IReactContext const &reactContext);
+
+// Re-reads the time zone rules and user languages once, then refreshes the mounted views of
+// every window in one batch on that window's UI thread. Call it when the system time zone or
+// regional settings change.
+void BroadcastTimeZoneOrLocaleChange() noexcept;
+
+} // namespace winrt::DateTimePicker
@@ -0,0 +1,197 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "SharedCache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Id of a window, unique for the lifetime of the process.
+/// </summary>
+using PickerWindowId = int64_t;
+
+/// <summary>
+/// Registry counters, summed over all threads.
+/// </summary>
+struct PickerWindowRegistryStats {
+  std::atomic<int64_t> created{0};       // windows created
+  std::atomic<int64_t> threadHits{0};    // lookups served by the calling thread's cache
+  std::atomic<int64_t> sharedLookups{0}; // lookups served by the shared directory
+};
+
+/// <summary>
+/// Process-wide directory of per-window state. Every React instance drives one window with its
+/// own UI dispatcher, so views and sessions find their window's dispatcher and caches here
+/// instead of sharing one set between windows.
+///
+/// The registry only holds weak references; the window lives as long as a module, view or
+/// session of that window holds it. Each thread remembers the last window it looked up, and a
+/// UI thread serves a single window, so steady-state lookups never leave the thread. Other
+/// lookups read the shared directory without locking; only creating a window takes the lock.
+/// </summary>
+template <typename TWindow>
+class PickerWindowRegistry {
+public:
+  explicit PickerWindowRegistry(PickerWindowRegistryStats &stats) noexcept : m_stats(stats) {}
+
+  PickerWindowRegistry(const PickerWindowRegistry &) = delete;
+  PickerWindowRegistry &operator=(const PickerWindowRegistry &) = delete;
+
+  /// <summary>
+  /// Reserves an id for a new window. Ids are never reused, so a window that outlives its
+  /// React instance cannot be mistaken for the window of a later instance.
+  /// </summary>
+  PickerWindowId NewWindowId() noexcept {
+    return m_nextId.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// <summary>
+  /// Returns the window with the given id, creating it when no live one exists. Served from
+  /// the calling thread's cache when the thread looked the same window up last.
+  /// </summary>
+  template <typename TCreate>
+  std::shared_ptr<TWindow> Get(PickerWindowId id, const TCreate &create) {
+    auto &cache = ThreadCache();
+    if (cache.registry == this && cache.id == id) {
+      if (auto window = cache.window.lock()) {
+        m_stats.threadHits.fetch_add(1, std::memory_order_relaxed);
+        return window;
+      }
+    }
+
+    auto window = Find(id);
+    if (window) {
+      m_stats.sharedLookups.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      window = Create(id, create);
+    }
+    cache = CacheEntry{this, id, window};
+    return window;
+  }
+
+  /// <summary>
+  /// Returns the window with the given id if it is still alive.
+  /// </summary>
+  std::shared_ptr<TWindow> Find(PickerWindowId id) const {
+    return m_windows.Read([id](const std::vector<Entry> &windows) -> std::shared_ptr<TWindow> {
+      auto entry = FindEntry(windows, id);
+      return entry != windows.end() && entry->id == id ? entry->window.lock() : nullptr;
+    });
+  }
+
+  /// <summary>
+  /// Number of windows still alive.
+  /// </summary>
+  size_t LiveWindows() const {
+    return m_windows.Read([](const std::vector<Entry> &windows) {
+      return static_cast<size_t>(
+          std::count_if(windows.begin(), windows.end(), [](const Entry &entry) { return !entry.window.expired(); }));
+    });
+  }
+
+  /// <summary>
+  /// The windows still alive, in id order, for work that spans all of them.
+  /// </summary>
+  std::vector<std::shared_ptr<TWindow>> Live() const {
+    return m_windows.Read([](const std::vector<Entry> &windows) {
+      std::vector<std::shared_ptr<TWindow>> live;
+      live.reserve(windows.size());
+      for (const auto &entry : windows) {
+        if (auto window = entry.window.lock()) {
+          live.push_back(std::move(window));
+        }
+      }
+      return live;
+    });
+  }
+
+  /// <summary>
+  /// Runs callback(window) for every live window, posted to that window's own dispatcher
+  /// (its dispatcher member). The posted work holds the window weakly, so a window torn down
+  /// before its turn is skipped, and a dispatcher that refuses the post, as one shutting down
+  /// does, does not keep the other windows from being reached.
+  /// </summary>
+  /// <returns>The number of windows posted to</returns>
+  template <typename TCallback>
+  size_t PostToLiveWindows(const TCallback &callback) const {
+    size_t posted = 0;
+    for (const auto &window : Live()) {
+      try {
+        window->dispatcher.Post([weakWindow = std::weak_ptr<TWindow>{window}, callback]() {
+          if (const auto window = weakWindow.lock()) {
+            callback(*window);
+          }
+        });
+        ++posted;
+      } catch (...) {
+        // The window's UI thread is shutting down; its views go with it
+      }
+    }
+    return posted;
+  }
+
+private:
+  struct Entry {
+    PickerWindowId id;
+    std::weak_ptr<TWindow> window;
+  };
+
+  struct CacheEntry {
+    const PickerWindowRegistry *registry{nullptr};
+    PickerWindowId id{0};
+    std::weak_ptr<TWindow> window;
+  };
+
+  static CacheEntry &ThreadCache() noexcept {
+    thread_local CacheEntry cache;
+    return cache;
+  }
+
+  template <typename TCreate>
+  std::shared_ptr<TWindow> Create(PickerWindowId id, const TCreate &create) {
+    std::lock_guard<std::mutex> lock{m_createMutex};
+
+    // Another thread may have created the window while this one waited
+    if (auto window = Find(id)) {
+      m_stats.sharedLookups.fetch_add(1, std::memory_order_relaxed);
+      return window;
+    }
+
+    std::shared_ptr<TWindow> window = create();
+    m_stats.created.fetch_add(1, std::memory_order_relaxed);
+    m_windows.Update([&](std::vector<Entry> &windows) {
+      // Windows come and go with React instances, so this stays short
+      windows.erase(
+          std::remove_if(windows.begin(), windows.end(), [](const Entry &item) { return item.window.expired(); }),
+          windows.end());
+      windows.insert(FindEntry(windows, id), Entry{id, window});
+    });
+    return window;
+  }
+
+  // First entry whose id is not less than the given one; the entries are sorted by id
+  static auto FindEntry(const std::vector<Entry> &windows, PickerWindowId id) {
+    return std::lower_bound(
+        windows.begin(), windows.end(), id, [](const Entry &entry, PickerWindowId value) { return entry.id < value; });
+  }
+
+  PickerWindowRegistryStats &m_stats;
+  std::atomic<PickerWindowId> m_nextId{1};
+
+  // Serializes window creation, so each id gets a single window
+  std::mutex m_createMutex;
+  SharedCache<std::vector<Entry>> m_windows;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
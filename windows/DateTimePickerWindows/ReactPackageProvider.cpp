@@ -7,25 +7,88 @@
 
 #include "DateTimePickerViewManager.h"
 #include "TimePickerViewManager.h"
+#include "PickerSessionBroker.h"
+#include "PickerWindow.h"
 
 #ifdef RNW_NEW_ARCH
 #include "DateTimePickerFabric.h"
 #include "TimePickerFabric.h"
 #include "DatePickerModuleWindows.h"
 #include "TimePickerModuleWindows.h"
+#include "PickerValuesModuleWindows.h"
+#include "PickerDateMathModuleWindows.h"
+#include "PickerEventBatchModuleWindows.h"
+#include "PickerIslandPool.h"
+#include "PickerWarmUpModuleWindows.h"
 #endif
 
 using namespace winrt::Microsoft::ReactNative;
 
 namespace winrt::DateTimePicker::implementation {
 
+  std::atomic<bool> ReactPackageProvider::s_batchChangeEvents{false};
+
+  bool ReactPackageProvider::BatchChangeEvents() noexcept {
+      return s_batchChangeEvents;
+  }
+
+  void ReactPackageProvider::BatchChangeEvents(bool value) noexcept {
+      s_batchChangeEvents = value;
+  }
+
+  std::atomic<uint32_t> ReactPackageProvider::s_pickerPoolSize{0};
+
+  uint32_t ReactPackageProvider::PickerPoolSize() noexcept {
+      return s_pickerPoolSize;
+  }
+
+  void ReactPackageProvider::PickerPoolSize(uint32_t value) noexcept {
+      s_pickerPoolSize = value;
+  }
+
+  uint32_t ReactPackageProvider::MaxPickerSessions() noexcept {
+      return Helpers::MaxPickerSessionsSetting();
+  }
+
+  void ReactPackageProvider::MaxPickerSessions(uint32_t value) noexcept {
+      Helpers::MaxPickerSessionsSetting() = value;
+  }
+
+  std::atomic<bool> ReactPackageProvider::s_warmUpPickers{false};
+
+  bool ReactPackageProvider::WarmUpPickers() noexcept {
+      return s_warmUpPickers;
+  }
+
+  void ReactPackageProvider::WarmUpPickers(bool value) noexcept {
+      s_warmUpPickers = value;
+  }
+
+  void ReactPackageProvider::CancelPickerWarmUp() noexcept {
+#ifdef RNW_NEW_ARCH
+      winrt::DateTimePicker::CancelPickerWarmUp();
+#endif
+  }
+
+  void ReactPackageProvider::NotifyTimeZoneOrLocaleChanged() noexcept {
+      winrt::DateTimePicker::BroadcastTimeZoneOrLocaleChange();
+  }
+
   void ReactPackageProvider::CreatePackage(IReactPackageBuilder const& packageBuilder) noexcept {
 #ifdef RNW_NEW_ARCH
       // Register Fabric (New Architecture) components
       RegisterDateTimePickerComponentView(packageBuilder);
       RegisterTimePickerComponentView(packageBuilder);
+
+      if (s_batchChangeEvents) {
+          EnablePickerEventBatching();
+      }
+      SetPickerIslandPoolSize(s_pickerPoolSize);
+      if (s_warmUpPickers) {
+          EnablePickerWarmUp();
+      }
       
-      // Register TurboModules
+      // Register TurboModules (including the JSI value reader, see PickerValuesModuleWindows.h)
       AddAttributedModules(packageBuilder, true);
 #else
       // Register legacy ViewManagers (Old Architecture)
@@ -5,6 +5,8 @@
 
 #include "ReactPackageProvider.g.h"
 
+#include <atomic>
+
 using namespace winrt::Microsoft::ReactNative;
 
 namespace winrt::DateTimePicker::implementation
@@ -14,6 +16,26 @@ namespace winrt::DateTimePicker::implementation
         ReactPackageProvider() = default;
 
         void CreatePackage(IReactPackageBuilder const& packageBuilder) noexcept;
+
+        static bool BatchChangeEvents() noexcept;
+        static void BatchChangeEvents(bool value) noexcept;
+
+        static uint32_t PickerPoolSize() noexcept;
+        static void PickerPoolSize(uint32_t value) noexcept;
+
+        static uint32_t MaxPickerSessions() noexcept;
+        static void MaxPickerSessions(uint32_t value) noexcept;
+
+        static bool WarmUpPickers() noexcept;
+        static void WarmUpPickers(bool value) noexcept;
+        static void CancelPickerWarmUp() noexcept;
+
+        static void NotifyTimeZoneOrLocaleChanged() noexcept;
+
+    private:
+        static std::atomic<bool> s_batchChangeEvents;
+        static std::atomic<uint32_t> s_pickerPoolSize;
+        static std::atomic<bool> s_warmUpPickers;
     };
 }  
 
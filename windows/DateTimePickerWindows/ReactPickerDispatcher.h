@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "PickerSessionBroker.h"
+#include "NativeModules.h"
+
+#include <winrt/Windows.System.Threading.h>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// IPickerDispatcher over a React dispatcher, such as ReactContext::UIDispatcher().
+/// Delayed callbacks run on a thread pool timer.
+/// </summary>
+class ReactPickerDispatcher final : public IPickerDispatcher {
+public:
+  explicit ReactPickerDispatcher(winrt::Microsoft::ReactNative::IReactDispatcher dispatcher) noexcept
+      : m_dispatcher(std::move(dispatcher)) {}
+
+  void Post(std::function<void()> callback) override {
+    m_dispatcher.Post([callback = std::move(callback)]() { callback(); });
+  }
+
+  void PostDelayed(std::chrono::milliseconds delay, std::function<void()> callback) override {
+    winrt::Windows::System::Threading::ThreadPoolTimer::CreateTimer(
+        [callback = std::move(callback)](auto const & /*timer*/) { callback(); }, delay);
+  }
+
+private:
+  winrt::Microsoft::ReactNative::IReactDispatcher m_dispatcher;
+};
+
+/// <summary>
+/// Runs callback(view) on the UI thread once the JS thread has worked through what was posted
+/// to it before, so deliveries to a busy JS thread are paced by it. The JS thread only passes
+/// the weak reference on; it is resolved on the UI thread, so the view is never used, nor
+/// released for the last time, anywhere else.
+/// </summary>
+template <typename TView, typename TCallback>
+void PostToUIAfterJS(
+    const winrt::Microsoft::ReactNative::IReactContext &context,
+    winrt::weak_ref<TView> view,
+    TCallback callback) {
+  context.JSDispatcher().Post(
+      [ui = context.UIDispatcher(), view = std::move(view), callback = std::move(callback)]() mutable {
+        ui.Post([view = std::move(view), callback = std::move(callback)]() mutable {
+          if (auto strongView = view.get()) {
+            callback(*strongView);
+          }
+        });
+      });
+}
+
+} // namespace winrt::DateTimePicker::Helpers
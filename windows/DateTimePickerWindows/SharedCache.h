@@ -0,0 +1,305 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Read-mostly data shared by all pickers: formatter tables, the day anchor, the window
+// directory. Readers never block and never write shared cache lines other than their own
+// announcement slot; writers publish a modified copy and retire the old one, which is freed
+// once every reader that could still see it has left (epoch-based reclamation).
+// Header-only and free of WinRT dependencies.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Reclamation domain shared by every SharedCache in the process. Each reading thread owns a
+/// slot where it announces the epoch it entered in; a retired value is freed once no slot
+/// announces an epoch at or before the one it was retired in.
+/// </summary>
+class EpochDomain {
+public:
+  /// <summary>
+  /// Threads that can read at the same time with their own slot. Further threads still read
+  /// without waiting, but hold back reclamation while they do.
+  /// </summary>
+  static constexpr size_t kReaderSlots = 256;
+
+  static EpochDomain &Shared() noexcept {
+    static EpochDomain domain;
+    return domain;
+  }
+
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+
+  /// <summary>
+  /// Marks the calling thread as reading for its lifetime. Nested guards are free.
+  /// </summary>
+  class ReadGuard {
+  public:
+    explicit ReadGuard(EpochDomain &domain) noexcept : m_domain(domain) {
+      m_domain.Enter();
+    }
+    ~ReadGuard() {
+      m_domain.Leave();
+    }
+
+    ReadGuard(const ReadGuard &) = delete;
+    ReadGuard &operator=(const ReadGuard &) = delete;
+
+  private:
+    EpochDomain &m_domain;
+  };
+
+  /// <summary>
+  /// Hands over a value no longer reachable by new readers, and frees whatever earlier
+  /// retired values no reader can still see.
+  /// </summary>
+  template <typename T>
+  void Retire(const T *value) {
+    // The pointer swap happened before this; readers that announce the next epoch see the new value
+    const uint64_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst);
+
+    std::lock_guard<std::mutex> lock{m_retiredMutex};
+    m_retired.push_back(Retired{epoch, value, [](const void *retired) { delete static_cast<const T *>(retired); }});
+    ReclaimLocked();
+  }
+
+  /// <summary>
+  /// Frees the retired values no reader can still see.
+  /// </summary>
+  void Reclaim() {
+    std::lock_guard<std::mutex> lock{m_retiredMutex};
+    ReclaimLocked();
+  }
+
+  /// <summary>
+  /// Retired values waiting for readers to leave.
+  /// </summary>
+  size_t PendingReclaims() const {
+    std::lock_guard<std::mutex> lock{m_retiredMutex};
+    return m_retired.size();
+  }
+
+private:
+  static constexpr uint64_t kIdle = std::numeric_limits<uint64_t>::max();
+
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> epoch{kIdle};
+    std::atomic<bool> claimed{false};
+  };
+
+  struct Retired {
+    uint64_t epoch;
+    const void *value;
+    void (*destroy)(const void *);
+  };
+
+  // The calling thread's slot and nesting depth. The slot is claimed on the first read and
+  // given back when the thread exits.
+  struct ThreadRecord {
+    ReaderSlot *slot{nullptr};
+    uint32_t depth{0};
+    bool overflow{false};
+
+    ~ThreadRecord() {
+      if (slot) {
+        slot->claimed.store(false, std::memory_order_release);
+      }
+    }
+  };
+
+  EpochDomain() noexcept = default;
+
+  ~EpochDomain() {
+    for (const auto &retired : m_retired) {
+      retired.destroy(retired.value);
+    }
+  }
+
+  static ThreadRecord &CurrentThread() noexcept {
+    thread_local ThreadRecord record;
+    return record;
+  }
+
+  void Enter() noexcept {
+    auto &record = CurrentThread();
+    if (record.depth++ > 0) {
+      return;
+    }
+
+    if (!record.slot && !record.overflow) {
+      record.slot = ClaimSlot();
+      record.overflow = record.slot == nullptr;
+    }
+
+    // Sequentially consistent with the writer's publish and scan: either the writer sees this
+    // announcement, or the load that follows it sees the value the writer published
+    if (record.slot) {
+      record.slot->epoch.store(m_epoch.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+    } else {
+      m_overflowReaders.fetch_add(1, std::memory_order_seq_cst);
+    }
+  }
+
+  void Leave() noexcept {
+    auto &record = CurrentThread();
+    if (--record.depth > 0) {
+      return;
+    }
+
+    if (record.slot) {
+      record.slot->epoch.store(kIdle, std::memory_order_release);
+    } else {
+      m_overflowReaders.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  ReaderSlot *ClaimSlot() noexcept {
+    for (auto &slot : m_slots) {
+      bool expected = false;
+      if (!slot.claimed.load(std::memory_order_relaxed) &&
+          slot.claimed.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+        return &slot;
+      }
+    }
+    return nullptr;
+  }
+
+  void ReclaimLocked() {
+    uint64_t oldestReader = kIdle;
+    if (m_overflowReaders.load(std::memory_order_seq_cst) > 0) {
+      oldestReader = 0;
+    } else {
+      for (const auto &slot : m_slots) {
+        oldestReader = std::min(oldestReader, slot.epoch.load(std::memory_order_seq_cst));
+      }
+    }
+
+    size_t kept = 0;
+    for (auto &retired : m_retired) {
+      if (retired.epoch < oldestReader) {
+        retired.destroy(retired.value);
+      } else {
+        m_retired[kept++] = retired;
+      }
+    }
+    m_retired.resize(kept);
+  }
+
+  std::array<ReaderSlot, kReaderSlots> m_slots;
+  alignas(64) std::atomic<uint64_t> m_epoch{1};
+  std::atomic<int64_t> m_overflowReaders{0};
+
+  mutable std::mutex m_retiredMutex;
+  std::vector<Retired> m_retired;
+};
+
+/// <summary>
+/// A value read on hot paths and rarely written. Reads are wait-free: they announce the
+/// reader's epoch and load one pointer. Updates copy the current value, modify the copy and
+/// publish it; writers are serialized and old copies are reclaimed through the EpochDomain.
+/// </summary>
+template <typename T>
+class SharedCache {
+public:
+  explicit SharedCache(T initial = T{}, EpochDomain &domain = EpochDomain::Shared())
+      : m_domain(domain), m_current(new T(std::move(initial))) {}
+
+  ~SharedCache() {
+    delete m_current.load(std::memory_order_relaxed);
+  }
+
+  SharedCache(const SharedCache &) = delete;
+  SharedCache &operator=(const SharedCache &) = delete;
+
+  /// <summary>
+  /// Pointer to the current value, valid while it is held. Hold it briefly: an open read
+  /// delays the reclamation of values retired in the meantime.
+  /// </summary>
+  class ReadPtr {
+  public:
+    ReadPtr(EpochDomain &domain, const std::atomic<const T *> &current) noexcept
+        : m_guard(domain), m_value(current.load(std::memory_order_seq_cst)) {}
+
+    const T &operator*() const noexcept {
+      return *m_value;
+    }
+    const T *operator->() const noexcept {
+      return m_value;
+    }
+
+  private:
+    EpochDomain::ReadGuard m_guard;
+    const T *m_value;
+  };
+
+  ReadPtr Read() const noexcept {
+    return ReadPtr{m_domain, m_current};
+  }
+
+  /// <summary>
+  /// Calls the reader with the current value and returns its result.
+  /// </summary>
+  template <typename TReader>
+  auto Read(TReader &&reader) const {
+    const auto value = Read();
+    return reader(*value);
+  }
+
+  /// <summary>
+  /// Publishes a copy of the current value changed by the updater. Returns what the updater
+  /// returns; an updater returning false for a bool leaves the cache untouched.
+  /// </summary>
+  template <typename TUpdater>
+  auto Update(TUpdater &&updater) {
+    std::lock_guard<std::mutex> lock{m_writeMutex};
+    auto copy = std::make_unique<T>(*m_current.load(std::memory_order_relaxed));
+    if constexpr (std::is_same_v<decltype(updater(*copy)), bool>) {
+      if (!updater(*copy)) {
+        return false;
+      }
+      PublishLocked(std::move(copy));
+      return true;
+    } else if constexpr (std::is_void_v<decltype(updater(*copy))>) {
+      updater(*copy);
+      PublishLocked(std::move(copy));
+    } else {
+      auto result = updater(*copy);
+      PublishLocked(std::move(copy));
+      return result;
+    }
+  }
+
+  /// <summary>
+  /// Replaces the value.
+  /// </summary>
+  void Publish(T value) {
+    std::lock_guard<std::mutex> lock{m_writeMutex};
+    PublishLocked(std::make_unique<T>(std::move(value)));
+  }
+
+private:
+  void PublishLocked(std::unique_ptr<T> value) {
+    const T *previous = m_current.exchange(value.release(), std::memory_order_seq_cst);
+    m_domain.Retire(previous);
+  }
+
+  EpochDomain &m_domain;
+  std::mutex m_writeMutex;
+  std::atomic<const T *> m_current;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
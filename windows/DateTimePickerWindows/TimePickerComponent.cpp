@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "TimePickerComponent.h"
+#include "XamlPickerControls.h"
 
 namespace winrt::DateTimePicker::Components {
 
@@ -10,32 +11,44 @@ TimePickerComponent::TimePickerComponent()
   : m_control(winrt::Microsoft::UI::Xaml::Controls::TimePicker{}) {
 }
 
-void TimePickerComponent::Open(
-    const ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerOpenParams& params,
-    TimeChangedCallback callback) {
+Helpers::TimeApplyPlan TimePickerComponent::BuildPlan(
+    const ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerOpenParams& params) {
+  Helpers::TimeApplyPlan plan;
 
-  // Store callback
-  m_timeChangedCallback = std::move(callback);
-
-  // Set properties from params
   if (auto is24Hour = params.is24Hour) {
-    m_control.ClockIdentifier(*is24Hour ? L"24HourClock" : L"12HourClock");
+    plan.is24Hour.Set(*is24Hour);
   }
 
   if (auto minuteInterval = params.minuteInterval) {
-    m_control.MinuteIncrement(static_cast<int32_t>(*minuteInterval));
+    plan.minuteIncrement.Set(static_cast<int32_t>(*minuteInterval));
   }
 
   if (auto selectedTime = params.selectedTime) {
-    // Convert timestamp (milliseconds since midnight) to TimeSpan
+    // Keep the hour and minute of the timestamp (milliseconds since midnight)
     const int64_t totalMilliseconds = static_cast<int64_t>(*selectedTime);
     const int64_t totalSeconds = totalMilliseconds / 1000;
     const int32_t hour = static_cast<int32_t>((totalSeconds / 3600) % 24);
     const int32_t minute = static_cast<int32_t>((totalSeconds % 3600) / 60);
-    
-    winrt::Windows::Foundation::TimeSpan timeSpan{};
-    timeSpan.Duration = (hour * 3600LL + minute * 60LL) * 10000000LL; // Convert to 100-nanosecond intervals
-    m_control.Time(timeSpan);
+
+    plan.time.Set((hour * 3600LL + minute * 60LL) * 1000LL);
+  }
+
+  Helpers::SharedApplyStats().plans.fetch_add(1, std::memory_order_relaxed);
+  return plan;
+}
+
+void TimePickerComponent::Open(const Helpers::TimeApplyPlan& plan, TimeChangedCallback callback) {
+  // Start from the default configuration; the component is reused across Open calls
+  Reset();
+
+  // Store callback
+  m_timeChangedCallback = std::move(callback);
+
+  // Set properties from the plan
+  {
+    Helpers::ScopedApplyTimer timer;
+    Helpers::XamlTimeControl<winrt::Microsoft::UI::Xaml::Controls::TimePicker> control{m_control};
+    Helpers::ApplyPlan(plan, control);
   }
 
   // Register event handler
@@ -45,6 +58,17 @@ void TimePickerComponent::Open(
       });
 }
 
+void TimePickerComponent::Reset() {
+  using winrt::Microsoft::UI::Xaml::Controls::TimePicker;
+
+  m_timeChangedRevoker.revoke();
+  m_timeChangedCallback = nullptr;
+
+  m_control.ClearValue(TimePicker::ClockIdentifierProperty());
+  m_control.ClearValue(TimePicker::MinuteIncrementProperty());
+  m_control.ClearValue(TimePicker::TimeProperty());
+}
+
 winrt::Microsoft::UI::Xaml::Controls::TimePicker TimePickerComponent::GetControl() const {
   return m_control;
 }
@@ -61,7 +85,9 @@ void TimePickerComponent::OnTimeChanged(
     const int32_t hour = static_cast<int32_t>(totalSeconds / 3600);
     const int32_t minute = static_cast<int32_t>((totalSeconds % 3600) / 60);
 
-    m_timeChangedCallback(hour, minute);
+    // Invoked through a copy: the callback may Reset() this component
+    const auto callback = m_timeChangedCallback;
+    callback(hour, minute);
   }
 }
 
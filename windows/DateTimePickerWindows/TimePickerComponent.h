@@ -4,6 +4,7 @@
 #pragma once
 
 #include "NativeModules.h"
+#include "PickerApplyPlan.h"
 #include <winrt/Microsoft.UI.Xaml.Controls.h>
 #include <functional>
 
@@ -20,11 +21,22 @@ public:
   TimePickerComponent();
 
   /// <summary>
-  /// Opens and configures the time picker with the provided parameters and callback.
-  /// Encapsulates configuration and event handler setup.
+  /// Converts the open parameters into control setters. Touches no XAML, so the module
+  /// runs it on the JS thread and leaves only the apply step to the UI thread.
   /// </summary>
-  void Open(const ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerOpenParams& params,
-            TimeChangedCallback callback);
+  static Helpers::TimeApplyPlan BuildPlan(const ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerOpenParams& params);
+
+  /// <summary>
+  /// Opens and configures the time picker with a prepared plan and callback.
+  /// Encapsulates configuration and event handler setup. Runs on the UI thread.
+  /// </summary>
+  void Open(const Helpers::TimeApplyPlan& plan, TimeChangedCallback callback);
+
+  /// <summary>
+  /// Detaches the callback and returns the control to its default configuration,
+  /// so the same component can serve the next Open.
+  /// </summary>
+  void Reset();
 
   /// <summary>
   /// Gets the underlying XAML control.
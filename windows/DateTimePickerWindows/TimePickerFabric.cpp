@@ -13,39 +13,252 @@
 
 #include <winrt/Microsoft.ReactNative.Xaml.h>
 
+#include "CivilDate.h"
+#include "DayAnchor.h"
+#include "PickerEventBatchModuleWindows.h"
+#include "PickerIslandPool.h"
+#include "PickerWarmUpModuleWindows.h"
+#include "ValueSnapshotRegistry.h"
+#include "DateTimeHelpers.h"
+#include "XamlPickerControls.h"
+
+#include <winrt/Microsoft.UI.h>
+#include <winrt/Microsoft.UI.Xaml.Input.h>
+#include <winrt/Microsoft.UI.Xaml.Media.h>
+#include <winrt/Windows.Globalization.h>
+
+#include <atomic>
+
 namespace winrt::DateTimePicker {
 
+namespace {
+
+using XamlTimeControl = Helpers::XamlTimeControl<winrt::Microsoft::UI::Xaml::Controls::TimePicker>;
+
+std::atomic<uint64_t> s_propsGeneration{0};
+
+} // anonymous namespace
+
+TimePickerPlannedProps::TimePickerPlannedProps(
+    winrt::Microsoft::ReactNative::ViewProps /*props*/,
+    const winrt::Microsoft::ReactNative::IComponentProps &cloneFrom)
+    : m_generation(s_propsGeneration.fetch_add(1, std::memory_order_relaxed) + 1) {
+  if (cloneFrom) {
+    const auto cloneFromProps = cloneFrom.as<TimePickerPlannedProps>();
+    m_values = cloneFromProps->m_values.Copy();
+    m_planBuilder = cloneFromProps->m_planBuilder;
+    m_planBuilder.ResetChanges();
+    m_clonedFromGeneration = cloneFromProps->m_generation;
+  }
+}
+
+void TimePickerPlannedProps::SetProp(
+    uint32_t /*hash*/,
+    winrt::hstring propName,
+    winrt::Microsoft::ReactNative::IJSValueReader value) noexcept {
+  const auto name = winrt::to_string(propName);
+  auto jsValue = winrt::Microsoft::ReactNative::JSValue::ReadFrom(value);
+  m_planBuilder.SetProp(name, Helpers::PickerPropValueFromJSValue(jsValue));
+  m_values[name] = std::move(jsValue);
+}
+
 // TimePickerComponentView method implementations
 
 void TimePickerComponentView::InitializeContentIsland(
     const winrt::Microsoft::ReactNative::Composition::ContentIslandComponentView &islandView) noexcept {
-  m_xamlIsland = winrt::Microsoft::UI::Xaml::XamlIsland{};
-  m_timePicker = winrt::Microsoft::UI::Xaml::Controls::TimePicker{};
+  // A mounted picker has already paid the costs the idle warm-up would have
+  NotifyPickerMounted();
+
+  // Controls are pooled per UI thread; the new island hosts a reset pooled control (see PickerIslandPool.h).
+  // Lazy views hand the control back when their first props arrive.
+  auto pickerIsland = AcquireTimePickerIsland();
+  m_xamlIsland = std::move(pickerIsland.island);
+  m_timePicker = std::move(pickerIsland.control);
+  m_islandStateChangedRevoker = m_xamlIsland.ContentIsland().StateChanged(
+      winrt::auto_revoke, [this](const winrt::Microsoft::UI::Content::ContentIsland &island, const auto &args) {
+        if (args.DidSiteVisibleChange()) {
+          OnVisibilityChanged(m_offscreen.SetSiteVisible(island.IsSiteVisible()));
+        }
+      });
   islandView.Connect(m_xamlIsland.ContentIsland());
 
+  // Publish committed values for synchronous reads from JS (see PickerValuesModuleWindows.h)
+  m_tag = islandView.Tag();
+  m_reactContext = islandView.ReactContext();
+  m_window = GetPickerWindow(m_reactContext);
+  m_valueSlot = m_window->values.Register(m_tag);
+
+  // Only a weak reference, so the window's view list never keeps the view alive
+  m_liveViewId = m_window->views.Add([weakThis = get_weak()]() {
+    if (auto strongThis = weakThis.get()) {
+      strongThis->RefreshForLocaleChange();
+      return true;
+    }
+    return false;
+  });
+
   RegisterEvents();
-  
-  // Mount the TimePicker immediately so it's visible
-  m_xamlIsland.Content(m_timePicker);
 }
 
 void TimePickerComponentView::RegisterEvents() {
+  // Offscreen views register it when they come back
+  if (m_offscreen.IsOffscreen()) {
+    return;
+  }
+
   // Register the TimeChanged event handler with auto_revoke
-  m_timeChangedRevoker = m_timePicker.TimeChanged(winrt::auto_revoke, [this](auto &&sender, auto &&args) {
-    if (m_eventEmitter) {
-      auto newTime = args.NewTime();
-      
-      // Convert TimeSpan to hour and minute
-      auto totalMinutes = newTime.count() / 10000000 / 60; // 100-nanosecond intervals to minutes
-      auto hour = static_cast<int32_t>(totalMinutes / 60);
-      auto minute = static_cast<int32_t>(totalMinutes % 60);
-      
-      winrt::Microsoft::ReactNative::JSValueObject eventData;
-      eventData["hour"] = hour;
-      eventData["minute"] = minute;
-      
-      m_eventEmitter(L"topChange", std::move(eventData));
+  m_timeChangedRevoker = SubscribeTimeChanged();
+}
+
+winrt::Microsoft::UI::Xaml::Controls::TimePicker::TimeChanged_revoker TimePickerComponentView::SubscribeTimeChanged() {
+  return m_timePicker.TimeChanged(winrt::auto_revoke, [this](auto &&sender, auto &&args) {
+    const auto millisecondsSinceMidnight = XamlTimeControl::MillisecondsFromTimeSpan(args.NewTime());
+    Helpers::CallbackEventEmitter emitter{[this, millisecondsSinceMidnight](int64_t timeInMilliseconds) {
+      DispatchTimeChanged(millisecondsSinceMidnight, timeInMilliseconds);
+    }};
+    m_logic.OnTimeChanged(millisecondsSinceMidnight, emitter);
+  });
+}
+
+void TimePickerComponentView::BecomeLazy() {
+  // The island shows the placeholder from now on, and the control goes back to the pool
+  m_timeChangedRevoker.revoke();
+  ShowPlaceholder();
+  ReleaseTimePickerIsland({nullptr, std::move(m_timePicker)});
+}
+
+void TimePickerComponentView::ShowPlaceholder() {
+  namespace xaml = winrt::Microsoft::UI::Xaml;
+
+  m_placeholderText = xaml::Controls::TextBlock{};
+  m_placeholderText.VerticalAlignment(xaml::VerticalAlignment::Center);
+
+  // A transparent background makes the whole area, not just the text, receive pointer input
+  xaml::Controls::Grid hitArea;
+  hitArea.Background(xaml::Media::SolidColorBrush{winrt::Microsoft::UI::Colors::Transparent()});
+  hitArea.Children().Append(m_placeholderText);
+
+  m_placeholder = xaml::Controls::ContentControl{};
+  m_placeholder.IsTabStop(true);
+  m_placeholder.HorizontalContentAlignment(xaml::HorizontalAlignment::Stretch);
+  m_placeholder.VerticalContentAlignment(xaml::VerticalAlignment::Stretch);
+  m_placeholder.Content(hitArea);
+
+  m_placeholderGotFocusRevoker =
+      m_placeholder.GotFocus(winrt::auto_revoke, [this](auto &&, auto &&) { Materialize(true); });
+  m_placeholderPointerEnteredRevoker =
+      m_placeholder.PointerEntered(winrt::auto_revoke, [this](auto &&, auto &&) { Materialize(false); });
+  m_placeholderTappedRevoker =
+      m_placeholder.Tapped(winrt::auto_revoke, [this](auto &&, auto &&) { Materialize(true); });
+
+  m_xamlIsland.Content(m_placeholder);
+}
+
+void TimePickerComponentView::UpdatePlaceholder(const Helpers::TimeApplyPlan &plan) {
+  if (!m_placeholder) {
+    return;
+  }
+
+  // Shows what the plan would set on the control
+  if (plan.time.value) {
+    // TimeSpan counts 100ns slices
+    m_placeholderText.Text(
+        Helpers::FormatTime(winrt::Windows::Foundation::TimeSpan{*plan.time.value * 10000}, plan.is24Hour.value));
+  } else {
+    m_placeholderText.Text(L"");
+  }
+}
+
+void TimePickerComponentView::Materialize(bool focus) {
+  if (m_timePicker || !m_xamlIsland) {
+    return;
+  }
+
+  m_placeholderGotFocusRevoker.revoke();
+  m_placeholderPointerEnteredRevoker.revoke();
+  m_placeholderTappedRevoker.revoke();
+
+  // Props received while lazy are applied before events are registered, so they do not fire onChange
+  m_timePicker = winrt::Microsoft::UI::Xaml::Controls::TimePicker{};
+  if (m_props) {
+    ApplyControlProps(m_props);
+  }
+  m_offscreen.DropPending();
+  RegisterEvents();
+
+  m_xamlIsland.Content(m_timePicker);
+  m_placeholder = nullptr;
+  m_placeholderText = nullptr;
+
+  if (focus) {
+    m_timePicker.Focus(winrt::Microsoft::UI::Xaml::FocusState::Programmatic);
+  }
+}
+
+TimePickerComponentView::~TimePickerComponentView() {
+  if (m_window) {
+    m_window->values.Unregister(m_valueSlot);
+    m_window->views.Remove(m_liveViewId);
+  }
+
+  // Return the island for reuse by the next view mounted on this thread. Lazy views that were
+  // never interacted with returned their control when they became lazy.
+  m_timeChangedRevoker.revoke();
+  m_islandStateChangedRevoker.revoke();
+  if (m_xamlIsland && m_timePicker) {
+    ReleaseTimePickerIsland({std::move(m_xamlIsland), std::move(m_timePicker)});
+  }
+}
+
+void TimePickerComponentView::DispatchTimeChanged(int64_t millisecondsSinceMidnight, int64_t timeInMilliseconds) {
+  if (m_valueSlot) {
+    // Committed value is today's date at the selected time, in milliseconds since Unix epoch
+    m_valueSlot->Publish(timeInMilliseconds);
+  }
+
+  if (m_eventEmitter) {
+    const auto totalMinutes = millisecondsSinceMidnight / (1000 * 60);
+    const auto hour = static_cast<int32_t>(totalMinutes / 60);
+    const auto minute = static_cast<int32_t>(totalMinutes % 60);
+
+    winrt::Microsoft::ReactNative::JSValueObject eventData;
+    eventData["hour"] = hour;
+    eventData["minute"] = minute;
+
+    if (m_includeFields) {
+      // The selected time always refers to today in the local time zone
+      const auto &anchor = Helpers::SharedDayAnchor();
+      const auto fields = Helpers::CalendarFieldsFromLocalMilliseconds(
+          anchor.ToLocalMilliseconds(anchor.LocalMidnightMilliseconds()));
+      eventData["year"] = fields.year;
+      eventData["month"] = fields.month;
+      eventData["day"] = fields.day;
+      eventData["weekday"] = fields.weekday;
+      eventData["dayOfYear"] = fields.dayOfYear;
+      eventData["isoWeek"] = fields.isoWeek;
+    }
+
+    if (m_window && IsPickerEventBatchingActive(*m_window)) {
+      // Delivered with the other pickers' events at the end of the frame
+      BatchPickerEvent(*m_window, m_tag, std::move(eventData));
+    } else if (m_eventQueue.Push(std::move(eventData))) {
+      ScheduleEventDrain();
     }
+  }
+}
+
+void TimePickerComponentView::ScheduleEventDrain() {
+  // Events are drained on the UI thread once the JS thread has caught up, so a busy JS thread
+  // sees a bounded backlog instead of every intermediate value (see EventQueue.h)
+  Helpers::PostToUIAfterJS(m_reactContext, get_weak(), [](TimePickerComponentView &view) {
+    view.m_eventQueue.Drain([&view](winrt::Microsoft::ReactNative::JSValueObject &&eventData, bool valuesSkipped) {
+      if (valuesSkipped) {
+        eventData["valuesSkipped"] = true;
+      }
+      if (view.m_eventEmitter) {
+        view.m_eventEmitter(L"topChange", std::move(eventData));
+      }
+    });
   });
 }
 
@@ -65,62 +278,121 @@ void WithEventSuspended(TRevoker& revoker, TSetup setup, TAction action) {
 
 void TimePickerComponentView::UpdateProps(
     const winrt::Microsoft::ReactNative::ComponentView &view,
-    const winrt::Microsoft::ReactNative::IJSValueReader &propsReader) noexcept {
-  
-  const winrt::Microsoft::ReactNative::JSValueObject props =
-      winrt::Microsoft::ReactNative::JSValueObject::ReadFrom(propsReader);
+    const winrt::com_ptr<TimePickerPlannedProps> &newProps) noexcept {
+  if (!newProps) {
+    return;
+  }
+
+  // Only the first props decide whether the view is lazy
+  const bool firstProps = !m_props;
+
+  // Kept so a lazy view can apply them when its control is created
+  m_props = newProps;
+  const auto &values = newProps->Values();
+
+  // Calendar fields are only computed for views that opt in
+  const auto includeFields = values.find("includeFields");
+  m_includeFields = includeFields != values.end() && includeFields->second.AsBoolean();
+
+  const auto selectedTime = values.find("selectedTime");
+  if (newProps->ParsedChanges().time.changed && selectedTime != values.end() && m_valueSlot) {
+    m_valueSlot->Publish(selectedTime->second.AsInt64());
+  }
+
+  if (const auto lazy = values.find("lazy"); firstProps && lazy != values.end() && lazy->second.AsBoolean()) {
+    BecomeLazy();
+  }
+
+  if (m_offscreen.IsOffscreen()) {
+    // Props are complete, so the latest ones replace any that are still pending
+    m_offscreen.Defer(newProps, [](auto &pending, auto &&update) { pending = std::move(update); });
+    return;
+  }
+
+  if (!m_timePicker) {
+    // Lazy views show the formatted value until the user interacts with them
+    UpdatePlaceholder(newProps->PlanSince(0));
+    return;
+  }
 
   // Suspend the TimeChanged event while updating properties programmatically
   // to avoid triggering onChange events for prop changes from JavaScript
   WithEventSuspended(
     m_timeChangedRevoker,
-    [this]() {
-      return m_timePicker.TimeChanged(winrt::auto_revoke, [this](auto &&sender, auto &&args) {
-        if (m_eventEmitter) {
-          auto newTime = args.NewTime();
-          auto totalMinutes = newTime.count() / 10000000 / 60;
-          auto hour = static_cast<int32_t>(totalMinutes / 60);
-          auto minute = static_cast<int32_t>(totalMinutes % 60);
-          
-          winrt::Microsoft::ReactNative::JSValueObject eventData;
-          eventData["hour"] = hour;
-          eventData["minute"] = minute;
-          
-          m_eventEmitter(L"topChange", std::move(eventData));
-        }
-      });
-    },
-    [this, &props]() {
-      // Update clock format (12-hour vs 24-hour)
-      if (props.find("is24Hour") != props.end()) {
-        const bool is24Hour = props["is24Hour"].AsBoolean();
-        m_timePicker.ClockIdentifier(
-            is24Hour 
-                ? winrt::to_hstring("24HourClock")
-                : winrt::to_hstring("12HourClock"));
-      }
+    [this]() { return SubscribeTimeChanged(); },
+    [this, &newProps]() { ApplyControlProps(newProps); }
+  );
+}
 
-      // Update minute increment
-      if (props.find("minuteInterval") != props.end()) {
-        const int32_t minuteInterval = static_cast<int32_t>(props["minuteInterval"].AsInt64());
-        m_timePicker.MinuteIncrement(minuteInterval);
-      }
+void TimePickerComponentView::RefreshForLocaleChange() {
+  if (!m_props) {
+    return;
+  }
 
-      // Update selected time
-      if (props.find("selectedTime") != props.end()) {
-        const int64_t timeInMilliseconds = props["selectedTime"].AsInt64();
-        const auto timeInSeconds = timeInMilliseconds / 1000;
-        const auto hours = (timeInSeconds / 3600) % 24;
-        const auto minutes = (timeInSeconds / 60) % 60;
-        
-        // Create TimeSpan (100-nanosecond intervals)
-        const winrt::Windows::Foundation::TimeSpan timeSpan{
-            static_cast<int64_t>((hours * 3600 + minutes * 60) * 10000000)
-        };
-        m_timePicker.Time(timeSpan);
-      }
+  // The props were planned in the previous time zone, so they are planned again here. This is
+  // the one update planned on the UI thread.
+  const auto plan = m_logic.BuildPlan(Helpers::JSValuePropReader{m_props->Values()});
+
+  if (!m_timePicker) {
+    // The shared formatters were reset, so this formats with the new settings
+    UpdatePlaceholder(plan);
+    return;
+  }
+
+  const auto refresh = [this, &plan]() {
+    // Without is24Hour the control follows the user's clock, which it only reads when created
+    if (m_props->Values().find("is24Hour") == m_props->Values().end()) {
+      m_timePicker.ClockIdentifier(winrt::Windows::Globalization::Calendar{}.GetClock());
     }
-  );
+    XamlTimeControl control{m_timePicker};
+    m_logic.Apply(plan, control);
+    m_appliedGeneration = m_props->Generation();
+  };
+
+  if (m_offscreen.IsOffscreen()) {
+    // The handler is already detached, and all props are now applied
+    refresh();
+    m_offscreen.DropPending();
+  } else {
+    WithEventSuspended(m_timeChangedRevoker, [this]() { return SubscribeTimeChanged(); }, refresh);
+  }
+}
+
+void TimePickerComponentView::UpdateLayoutMetrics(
+    const winrt::Microsoft::ReactNative::LayoutMetrics &newLayoutMetrics) noexcept {
+  // A collapsed parent or display: none lays the view out with no area
+  OnVisibilityChanged(m_offscreen.SetLayoutSize(newLayoutMetrics.Frame.Width, newLayoutMetrics.Frame.Height));
+}
+
+void TimePickerComponentView::OnVisibilityChanged(OffscreenProps::Transition transition) {
+  if (transition == OffscreenProps::Transition::Hidden) {
+    m_timeChangedRevoker.revoke();
+    return;
+  }
+
+  if (transition != OffscreenProps::Transition::Shown) {
+    return;
+  }
+
+  // Applied before the handler is back, so the held-back props do not fire onChange
+  if (const auto pending = m_offscreen.TakePending()) {
+    if (m_timePicker) {
+      ApplyControlProps(*pending);
+    } else {
+      UpdatePlaceholder((*pending)->PlanSince(0));
+    }
+  }
+
+  if (m_timePicker) {
+    RegisterEvents();
+  }
+}
+
+void TimePickerComponentView::ApplyControlProps(const winrt::com_ptr<TimePickerPlannedProps> &props) {
+  // The plan was built when the props were parsed
+  XamlTimeControl control{m_timePicker};
+  m_logic.Apply(props->PlanSince(m_appliedGeneration), control);
+  m_appliedGeneration = props->Generation();
 }
 
 void TimePickerComponentView::SetEventEmitter(
@@ -144,16 +416,28 @@ void RegisterTimePickerComponentView(winrt::Microsoft::ReactNative::IReactPackag
               islandView.UserData(*userData);
             });
 
+        // Props plan every update as they are parsed, so the handler only applies the plan
+        builder.SetCreateProps([](winrt::Microsoft::ReactNative::ViewProps props,
+                                  const winrt::Microsoft::ReactNative::IComponentProps &cloneFrom) noexcept {
+          return winrt::make<winrt::DateTimePicker::TimePickerPlannedProps>(props, cloneFrom);
+        });
+
         builder.SetUpdatePropsHandler([](const winrt::Microsoft::ReactNative::ComponentView &view,
                                          const winrt::Microsoft::ReactNative::IComponentProps &newProps,
                                          const winrt::Microsoft::ReactNative::IComponentProps &oldProps) noexcept {
           auto userData = view.UserData().as<winrt::DateTimePicker::TimePickerComponentView>();
-          auto reader = newProps.as<winrt::Microsoft::ReactNative::IComponentProps>().try_as<winrt::Microsoft::ReactNative::IJSValueReader>();
-          if (reader) {
-            userData->UpdateProps(view, reader);
+          if (newProps) {
+            userData->UpdateProps(view, newProps.as<winrt::DateTimePicker::TimePickerPlannedProps>());
           }
         });
 
+        compBuilder.SetUpdateLayoutMetricsHandler([](const winrt::Microsoft::ReactNative::ComponentView &view,
+                                                     const winrt::Microsoft::ReactNative::LayoutMetrics &newLayoutMetrics,
+                                                     const winrt::Microsoft::ReactNative::LayoutMetrics & /*oldLayoutMetrics*/) noexcept {
+          auto userData = view.UserData().as<winrt::DateTimePicker::TimePickerComponentView>();
+          userData->UpdateLayoutMetrics(newLayoutMetrics);
+        });
+
         compBuilder.SetUpdateEventEmitterHandler([](const winrt::Microsoft::ReactNative::ComponentView &view,
                                                     const winrt::Microsoft::ReactNative::Composition::ViewComponentView::EventEmitterDelegate &eventEmitter) noexcept {
           auto userData = view.UserData().as<winrt::DateTimePicker::TimePickerComponentView>();
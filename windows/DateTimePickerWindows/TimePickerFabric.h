@@ -5,16 +5,65 @@
 
 #if defined(RNW_NEW_ARCH)
 
+#include <winrt/Microsoft.UI.Content.h>
 #include <winrt/Microsoft.UI.Xaml.Controls.h>
 #include <winrt/Windows.Foundation.h>
 #include <winrt/Microsoft.ReactNative.h>
 #include <winrt/Microsoft.ReactNative.Composition.h>
 
+#include "EventQueue.h"
+#include "OffscreenUpdates.h"
+#include "PickerLogic.h"
+#include "PickerWindow.h"
+
 namespace winrt::DateTimePicker {
 
+// Props of a TimePicker view. They keep the parsed values and plan the control update as each
+// prop is parsed, on the JS thread, so the UI thread only applies the plan.
+struct TimePickerPlannedProps
+    : winrt::implements<TimePickerPlannedProps, winrt::Microsoft::ReactNative::IComponentProps> {
+  TimePickerPlannedProps(
+      winrt::Microsoft::ReactNative::ViewProps props,
+      const winrt::Microsoft::ReactNative::IComponentProps &cloneFrom);
+
+  void SetProp(uint32_t hash, winrt::hstring propName, winrt::Microsoft::ReactNative::IJSValueReader value) noexcept;
+
+  // Every prop set so far
+  const winrt::Microsoft::ReactNative::JSValueObject &Values() const noexcept {
+    return m_values;
+  }
+
+  // Setters for the props parsed into this object, on top of the ones it was cloned from
+  const Helpers::TimeApplyPlan &ParsedChanges() const noexcept {
+    return m_planBuilder.Changes();
+  }
+
+  // Identifies these props to the view that applies them
+  uint64_t Generation() const noexcept {
+    return m_generation;
+  }
+
+  // Setters that bring a control showing the props of the given generation up to these props.
+  // Only the parsed changes when these props were cloned from that generation, otherwise every
+  // prop set so far; generation 0 is a control that has shown no props.
+  const Helpers::TimeApplyPlan &PlanSince(uint64_t appliedGeneration) const noexcept {
+    return appliedGeneration != 0 && appliedGeneration == m_clonedFromGeneration ? m_planBuilder.Changes()
+                                                                                 : m_planBuilder.All();
+  }
+
+private:
+  winrt::Microsoft::ReactNative::JSValueObject m_values;
+  Helpers::TimePlanBuilder m_planBuilder{Helpers::SharedDayAnchor()};
+  uint64_t m_generation;
+  uint64_t m_clonedFromGeneration{0};
+};
+
 // TimePickerComponentView implements the Fabric architecture for TimePicker
-// using XAML TimePicker hosted in a XamlIsland
+// using XAML TimePicker hosted in a XamlIsland. With the lazy prop the control is
+// only created once the user interacts with the view.
 struct TimePickerComponentView : public winrt::implements<TimePickerComponentView, winrt::IInspectable> {
+  ~TimePickerComponentView();
+
   void InitializeContentIsland(
       const winrt::Microsoft::ReactNative::Composition::ContentIslandComponentView &islandView) noexcept;
 
@@ -22,16 +71,56 @@ struct TimePickerComponentView : public winrt::implements<TimePickerComponentVie
 
   void UpdateProps(
       const winrt::Microsoft::ReactNative::ComponentView &view,
-      const winrt::Microsoft::ReactNative::IJSValueReader &propsReader) noexcept;
+      const winrt::com_ptr<TimePickerPlannedProps> &newProps) noexcept;
+
+  void UpdateLayoutMetrics(const winrt::Microsoft::ReactNative::LayoutMetrics &newLayoutMetrics) noexcept;
 
   void SetEventEmitter(
       winrt::Microsoft::ReactNative::Composition::ViewComponentView::EventEmitterDelegate const &eventEmitter) noexcept;
 
 private:
+  void DispatchTimeChanged(int64_t millisecondsSinceMidnight, int64_t timeInMilliseconds);
+  void ScheduleEventDrain();
+  winrt::Microsoft::UI::Xaml::Controls::TimePicker::TimeChanged_revoker SubscribeTimeChanged();
+  void ApplyControlProps(const winrt::com_ptr<TimePickerPlannedProps> &props);
+
+  // Lazy views show their value in a TextBlock and only create the TimePicker
+  // on focus, pointer-over or tap
+  void BecomeLazy();
+  void ShowPlaceholder();
+  void UpdatePlaceholder(const Helpers::TimeApplyPlan &plan);
+  void Materialize(bool focus);
+
+  // Re-applies the formatted value and control props after a time zone or language change
+  // (see BroadcastTimeZoneOrLocaleChange)
+  void RefreshForLocaleChange();
+
+  // Offscreen views keep their island but detach the TimeChanged handler and hold back prop
+  // updates, applying only the latest props when they come back (see OffscreenUpdates.h)
+  using OffscreenProps = Helpers::OffscreenUpdates<winrt::com_ptr<TimePickerPlannedProps>>;
+  void OnVisibilityChanged(OffscreenProps::Transition transition);
+
   winrt::Microsoft::UI::Xaml::XamlIsland m_xamlIsland{nullptr};
   winrt::Microsoft::UI::Xaml::Controls::TimePicker m_timePicker{nullptr};
   winrt::Microsoft::UI::Xaml::Controls::TimePicker::TimeChanged_revoker m_timeChangedRevoker;
+  winrt::com_ptr<TimePickerPlannedProps> m_props;
+  uint64_t m_appliedGeneration{0}; // of the props last set on the control
+  Helpers::TimePickerLogic m_logic{Helpers::SharedDayAnchor()};
+  winrt::Microsoft::UI::Xaml::Controls::ContentControl m_placeholder{nullptr};
+  winrt::Microsoft::UI::Xaml::Controls::TextBlock m_placeholderText{nullptr};
+  winrt::Microsoft::UI::Xaml::UIElement::GotFocus_revoker m_placeholderGotFocusRevoker;
+  winrt::Microsoft::UI::Xaml::UIElement::PointerEntered_revoker m_placeholderPointerEnteredRevoker;
+  winrt::Microsoft::UI::Xaml::UIElement::Tapped_revoker m_placeholderTappedRevoker;
+  winrt::Microsoft::UI::Content::ContentIsland::StateChanged_revoker m_islandStateChangedRevoker;
+  OffscreenProps m_offscreen;
   winrt::Microsoft::ReactNative::Composition::ViewComponentView::EventEmitterDelegate m_eventEmitter;
+  bool m_includeFields = false;
+  int64_t m_tag = 0;
+  winrt::Microsoft::ReactNative::IReactContext m_reactContext{nullptr};
+  Helpers::PickerEventQueue<winrt::Microsoft::ReactNative::JSValueObject> m_eventQueue;
+  std::shared_ptr<PickerWindow> m_window; // bound when the island is initialized
+  Helpers::PickerValueRegistry::Slot *m_valueSlot{nullptr};
+  Helpers::LivePickerViews::ViewId m_liveViewId{0};
 };
 
 } // namespace winrt::DateTimePicker
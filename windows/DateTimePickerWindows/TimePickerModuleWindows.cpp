@@ -7,14 +7,22 @@
 
 #include "pch.h"
 #include "TimePickerModuleWindows.h"
+#include "CivilDate.h"
+#include "DayAnchor.h"
 
 #include <winrt/Microsoft.ReactNative.Xaml.h>
 #include <winrt/Microsoft.UI.Xaml.h>
 
 namespace winrt::DateTimePicker {
 
+TimePickerModule::~TimePickerModule() noexcept {
+  // The components are destroyed on the UI thread, never on the thread tearing down the module
+  SessionHost::Release(std::move(m_sessionHost));
+}
+
 void TimePickerModule::Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept {
   m_reactContext = reactContext;
+  m_sessionHost = std::make_shared<SessionHost>(GetPickerWindow(reactContext.Handle()));
 }
 
 // Called from JavaScript via DateTimePickerWindows.open() TurboModule API
@@ -29,49 +37,95 @@ void TimePickerModule::Initialize(winrt::Microsoft::ReactNative::ReactContext co
 // See: src/DateTimePickerWindows.windows.js and docs/windows-xaml-support.md
 void TimePickerModule::Open(ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerOpenParams &&params,
                             winrt::Microsoft::ReactNative::ReactPromise<ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerResult> promise) noexcept {
-  // Store the promise
-  m_currentPromise = promise;
-
-  // Create and open the time picker component
-  // Direct assignment automatically destroys any existing picker
-  m_timePickerComponent = std::make_unique<Components::TimePickerComponent>();
-  m_timePickerComponent->Open(params,
-      [this](const int32_t hour, const int32_t minute) {
-        if (m_currentPromise) {
-          ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerResult result;
-          result.action = "timeSetAction";
-          result.hour = hour;
-          result.minute = minute;
-
-          m_currentPromise.Resolve(result);
-          m_currentPromise = nullptr;
-          
-          // Clean up the picker after resolving
-          m_timePickerComponent.reset();
-        }
-      });
-
-  // Note: Similar to DatePicker, a full implementation would show this in a
-  // ContentDialog or Flyout. For now, this is a simplified version.
+  std::optional<std::chrono::milliseconds> timeout;
+  if (params.timeoutMs && *params.timeoutMs > 0) {
+    timeout = std::chrono::milliseconds{static_cast<int64_t>(*params.timeoutMs)};
+  }
+
+  // Opens without an id share id 0, so they replace each other as before
+  const auto id = static_cast<Helpers::PickerSessionId>(params.sessionId.value_or(0));
+
+  // All conversions happen here on the JS thread; the session only runs the control setters
+  // on the UI thread
+  RunSession(m_sessionHost, m_reactContext.Properties().Handle(), id, Components::TimePickerComponent::BuildPlan(params), params.includeFields.value_or(false), timeout, promise);
 }
 
-void TimePickerModule::Dismiss(winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept {
-  if (m_currentPromise) {
-    // Resolve the current picker promise with dismissed action
-    ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerResult result;
+Helpers::PickerTask TimePickerModule::RunSession(std::shared_ptr<SessionHost> host,
+                                                 winrt::Microsoft::ReactNative::IReactPropertyBag properties,
+                                                 Helpers::PickerSessionId id,
+                                                 Helpers::TimeApplyPlan plan,
+                                                 bool includeFields,
+                                                 std::optional<std::chrono::milliseconds> timeout,
+                                                 winrt::Microsoft::ReactNative::ReactPromise<Result> promise) noexcept {
+  // Starting a session cancels the one it replaces, so that promise still settles
+  const auto session = host->sessions.Begin(id, timeout);
+
+  co_await Helpers::ResumeOn(host->dispatcher);
+
+  // The session may have been dismissed or replaced while this continuation was queued.
+  // Each session configures its own component, taken from the pool on the UI thread, so
+  // concurrent sessions never share a control.
+  std::unique_ptr<Components::TimePickerComponent> component;
+  std::optional<Helpers::PickerSessionDialog> dialog;
+  if (!session->IsResolved()) {
+    component = host->components.Acquire();
+    component->Open(plan, [session](const int32_t hour, const int32_t minute) {
+      session->Resolve(Helpers::PickerSessionOutcome::Selected, TimeSelection{hour, minute});
+    });
+
+    // The session counts as open once the dialog is on screen, and closing the dialog dismisses it
+    dialog.emplace(
+        properties,
+        component->GetControl(),
+        [session]() { session->MarkOpen(); },
+        [session]() { session->Resolve(Helpers::PickerSessionOutcome::Dismissed); });
+  }
+
+  // Resumes on the UI thread once the session settles
+  const auto [outcome, selection] = co_await *session;
+  host->sessions.End(session);
+
+  // Hides the dialog when the session was settled elsewhere, and frees the control for the pool
+  if (dialog) {
+    dialog->Close();
+  }
+
+  // Returning the component here rather than in the selection callback keeps the control's own
+  // event handler off the stack. The pool resets it for the next session.
+  if (component) {
+    host->components.Release(std::move(component));
+  }
+  session->Close();
+
+  Result result;
+  result.sessionId = static_cast<double>(session->Id());
+  if (outcome == Helpers::PickerSessionOutcome::Selected && selection) {
+    result.action = "timeSetAction";
+    result.hour = selection->hour;
+    result.minute = selection->minute;
+    if (includeFields) {
+      // The selected time always refers to today in the local time zone
+      const auto &anchor = Helpers::SharedDayAnchor();
+      Helpers::AssignCalendarFields(
+          result,
+          Helpers::CalendarFieldsFromLocalMilliseconds(anchor.ToLocalMilliseconds(anchor.LocalMidnightMilliseconds())));
+    }
+  } else {
     result.action = "dismissedAction";
     result.hour = 0;
     result.minute = 0;
-
-    m_currentPromise.Resolve(result);
-    m_currentPromise = nullptr;
   }
-
-  // Clean up component
-  m_timePickerComponent.reset();
-  promise.Resolve(true);
+  promise.Resolve(result);
 }
 
-} // namespace winrt::DateTimePicker
+void TimePickerModule::Dismiss(std::optional<double> sessionId, winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept {
+  // Settles the pending opens with dismissedAction; their sessions return the components on the UI thread
+  if (sessionId) {
+    promise.Resolve(m_sessionHost->sessions.Dismiss(static_cast<Helpers::PickerSessionId>(*sessionId)));
+  } else {
+    m_sessionHost->sessions.DismissAll();
+    promise.Resolve(true);
+  }
+}
 
 } // namespace winrt::DateTimePicker
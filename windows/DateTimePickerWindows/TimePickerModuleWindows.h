@@ -6,14 +6,28 @@
 #include "NativeModules.h"
 #include "NativeModulesWindows.g.h"
 #include "TimePickerComponent.h"
+#include "PickerSessionDialog.h"
+#include "PickerSessionHost.h"
+#include <chrono>
 #include <memory>
+#include <optional>
 
 namespace winrt::DateTimePicker {
 
+/// <summary>
+/// Time picked during an open session.
+/// </summary>
+struct TimeSelection {
+  int32_t hour;
+  int32_t minute;
+};
+
 REACT_MODULE(TimePickerModule)
 struct TimePickerModule {
   using ModuleSpec = ReactNativeSpecs::TimePickerModuleWindowsSpec;
 
+  ~TimePickerModule() noexcept;
+
   REACT_INIT(Initialize)
   void Initialize(winrt::Microsoft::ReactNative::ReactContext const &reactContext) noexcept;
 
@@ -22,12 +36,26 @@ struct TimePickerModule {
             winrt::Microsoft::ReactNative::ReactPromise<ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerResult> promise) noexcept;
 
   REACT_METHOD(Dismiss, L"dismiss")
-  void Dismiss(winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept;
+  void Dismiss(std::optional<double> sessionId, winrt::Microsoft::ReactNative::ReactPromise<bool> promise) noexcept;
 
  private:
+  using Result = ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerResult;
+
+  using SessionHost = Helpers::PickerSessionHost<Components::TimePickerComponent, TimeSelection>;
+
+  // Runs one open request: configures the picker on the UI thread, shows it in a dialog over
+  // the instance's window (see PickerSessionDialog.h) and settles the promise once the session
+  // is selected, dismissed, timed out or replaced by a newer open with the same id.
+  static Helpers::PickerTask RunSession(std::shared_ptr<SessionHost> host,
+                                        winrt::Microsoft::ReactNative::IReactPropertyBag properties,
+                                        Helpers::PickerSessionId id,
+                                        Helpers::TimeApplyPlan plan,
+                                        bool includeFields,
+                                        std::optional<std::chrono::milliseconds> timeout,
+                                        winrt::Microsoft::ReactNative::ReactPromise<Result> promise) noexcept;
+
   winrt::Microsoft::ReactNative::ReactContext m_reactContext{nullptr};
-  std::unique_ptr<Components::TimePickerComponent> m_timePickerComponent;
-  winrt::Microsoft::ReactNative::ReactPromise<ReactNativeSpecs::TimePickerModuleWindowsSpec_TimePickerResult> m_currentPromise{nullptr};
+  std::shared_ptr<SessionHost> m_sessionHost;
 };
 
 } // namespace winrt::DateTimePicker
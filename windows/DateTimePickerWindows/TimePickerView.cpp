@@ -5,9 +5,7 @@
 #include "JSValueXaml.h"
 #include "TimePickerView.h"
 #include "TimePickerView.g.cpp"
-
-#include <winrt/Windows.Globalization.h>
-
+#include "ReactPickerDispatcher.h"
 
 namespace winrt {
     using namespace Microsoft::ReactNative;
@@ -30,85 +28,48 @@ namespace winrt::DateTimePicker::implementation {
     }
 
     void TimePickerView::UpdateProperties(winrt::IJSValueReader const& reader) {
-        m_updating = true;
-
-        bool updateSelectedTime = false;
         auto const& propertyMap = JSValueObject::ReadFrom(reader);
 
-        for (auto const& pair : propertyMap) {
-            auto const& propertyName = pair.first;
-            auto const& propertyValue = pair.second;
-
-            if (propertyName == "selectedTime") {
-                if (propertyValue.IsNull()) {
-                    this->ClearValue(xaml::Controls::TimePicker::TimeProperty());
-                }
-                else {
-                    // Incoming value will be in milliseconds from Jan 1, 1970.
-                    // Need to extract hours and minutes elapsed since midnight today.
-                    auto minutesSinceEpoch = propertyValue.AsInt64() / (1000 * 60);
-                    auto minutesToday = minutesSinceEpoch % (24 * 60);
-                    m_selectedTime = minutesToday;
-
-                    updateSelectedTime = true;
-                }
-            } else if (propertyName == "is24Hour") {
-                if (propertyValue.IsNull()) {
-                    this->ClearValue(xaml::Controls::TimePicker::ClockIdentifierProperty());
-                } else {
-                    auto is24Hours = propertyValue.AsJSBoolean();
-                    if (is24Hours) {
-                        this->ClockIdentifier(winrt::Windows::Globalization::ClockIdentifiers::TwentyFourHour());
-                    } else {
-                        this->ClockIdentifier(winrt::Windows::Globalization::ClockIdentifiers::TwelveHour());
-                    }
-                }
-            } else if (propertyName == "minuteInterval") {
-                if (propertyValue.IsNull()) {
-                    this->ClearValue(xaml::Controls::TimePicker::MinuteIncrementProperty());
-                }
-                else {
-                    auto minuteIncrement = propertyValue.AsInt32();
-                    this->MinuteIncrement(minuteIncrement);
-                }
-            }
-
-        }
-
-        if (updateSelectedTime) {
-            this->Time(winrt::TimeSpan{ m_selectedTime * 60 * 1000 * 10000 });
-        }
-
-        m_updating = false;
+        // Paper view managers receive props on the UI thread, after the JS thread has let go of
+        // them, so the plan is built and applied here in one step. Only the Fabric views plan
+        // where the props are parsed.
+        XamlTimeControl control{ *this };
+        m_logic.UpdateProps(Helpers::JSValuePropReader{ propertyMap }, control);
     }
 
     void TimePickerView::OnTimeChanged(winrt::IInspectable const& /*sender*/, xaml::Controls::TimePickerSelectedValueChangedEventArgs const& args) {
-        if (!m_updating) {
-            const int secondsPerDay = 24 * 3600;
-            const int chronoSliceInMillis = 10000;
-
-            // The React Native component uses the JavaScript Date() class to represent the selected time, which stores milliseconds internally.
-            // User-selected time is represented as the number of 100ns slices elapsed from midnight (due to std::chrono). Conversion is required.
-            // As in iOS, the no. of miliseconds returned in the event will correspond to today's date, with the time value selected by the user.
-            // Additionally, JavaScript uses Jan 1, 1970 as its starting point for date calculations. std::chrono uses Jan 1, 1601. 
-
-            auto selectedTime = args.NewTime().GetTimeSpan().count();
-            selectedTime = selectedTime / chronoSliceInMillis;
-
-            auto nowInSeconds = winrt::clock::to_time_t(winrt::DateTime::clock::now());
-            auto daysSinceDawnOfTime = nowInSeconds / secondsPerDay;
-            auto tickCount = (daysSinceDawnOfTime * secondsPerDay) * 1000 + selectedTime;
+        // The React Native component uses the JavaScript Date() class to represent the selected time, which stores milliseconds internally.
+        // As in iOS, the no. of miliseconds returned in the event will correspond to today's date, with the time value selected by the user.
+        // Today's local midnight is cached by the shared day anchor, which refreshes itself at every day boundary.
+        Helpers::CallbackEventEmitter emitter{ [this](int64_t tickCount) { QueueChangeEvent(tickCount); } };
+        m_logic.OnTimeChanged(XamlTimeControl::MillisecondsFromTimeSpan(args.NewTime().GetTimeSpan()), emitter);
+    }
 
-            m_reactContext.DispatchEvent(
-                *this,
-                L"topChange",
-                [&](winrt::Microsoft::ReactNative::IJSValueWriter const& eventDataWriter) noexcept {
-                    eventDataWriter.WriteObjectBegin();
-                    {
-                        WriteProperty(eventDataWriter, L"newDate", tickCount);
-                    }
-                    eventDataWriter.WriteObjectEnd();
+    void TimePickerView::QueueChangeEvent(int64_t tickCount) {
+        // Events are drained on the UI thread once the JS thread has caught up, so a busy JS thread
+        // sees a bounded backlog instead of every intermediate value (see EventQueue.h)
+        if (m_eventQueue.Push(tickCount)) {
+            Helpers::PostToUIAfterJS(m_reactContext, get_weak(), [](TimePickerView& view) {
+                view.m_eventQueue.Drain([&view](int64_t newDate, bool valuesSkipped) {
+                    view.DispatchChangeEvent(newDate, valuesSkipped);
                 });
+            });
         }
     }
+
+    void TimePickerView::DispatchChangeEvent(int64_t tickCount, bool valuesSkipped) {
+        m_reactContext.DispatchEvent(
+            *this,
+            L"topChange",
+            [&](winrt::Microsoft::ReactNative::IJSValueWriter const& eventDataWriter) noexcept {
+                eventDataWriter.WriteObjectBegin();
+                {
+                    WriteProperty(eventDataWriter, L"newDate", tickCount);
+                    if (valuesSkipped) {
+                        WriteProperty(eventDataWriter, L"valuesSkipped", true);
+                    }
+                }
+                eventDataWriter.WriteObjectEnd();
+            });
+    }
 }
\ No newline at end of file
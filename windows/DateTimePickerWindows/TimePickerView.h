@@ -6,6 +6,9 @@
 #include "TimePickerView.g.h"
 #include "winrt/Microsoft.ReactNative.h"
 #include "NativeModules.h"
+#include "EventQueue.h"
+#include "PickerLogic.h"
+#include "XamlPickerControls.h"
 
 namespace winrt::DateTimePicker::implementation {
     
@@ -17,14 +20,18 @@ namespace winrt::DateTimePicker::implementation {
         void UpdateProperties(Microsoft::ReactNative::IJSValueReader const& reader);
 
     private:
+        using XamlTimeControl = Helpers::XamlTimeControl<xaml::Controls::TimePicker>;
+
         Microsoft::ReactNative::IReactContext m_reactContext{ nullptr };
-        bool m_updating{ false };
         xaml::Controls::TimePicker::SelectedTimeChanged_revoker m_timePickerSelectedTimeChangedRevoker{};
 
         void RegisterEvents();
         void OnTimeChanged(winrt::Windows::Foundation::IInspectable const& sender, xaml::Controls::TimePickerSelectedValueChangedEventArgs  const& args);
-        
-        int64_t m_selectedTime;
+        void QueueChangeEvent(int64_t tickCount);
+        void DispatchChangeEvent(int64_t tickCount, bool valuesSkipped);
+
+        Helpers::TimePickerLogic m_logic{ Helpers::SharedDayAnchor() };
+        Helpers::PickerEventQueue<int64_t> m_eventQueue;
     };
 }
 
@@ -0,0 +1,252 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Fixed-capacity map from React view tag to the last value committed by that view
+/// (milliseconds since Unix epoch). The UI thread publishes, the JS thread reads synchronously
+/// through the JSI host object, and reads never block.
+///
+/// Values live in slots whose addresses never change, so views publish without a lookup. Tags
+/// are found through an open-addressing index of slot numbers. Unregistering leaves a tombstone
+/// in the index; once they pile up, the index is rebuilt without them into a second copy,
+/// and readers that were probing the old copy at that moment retry.
+/// </summary>
+template <size_t Capacity>
+class ValueSnapshotRegistry {
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  /// <summary>
+  /// Per-view slot. Only the owning view writes to it.
+  /// </summary>
+  class Slot {
+  public:
+    void Publish(int64_t value) noexcept {
+      m_value.store(value, std::memory_order_relaxed);
+      m_hasValue.store(true, std::memory_order_release);
+    }
+
+    void Clear() noexcept {
+      m_hasValue.store(false, std::memory_order_release);
+    }
+
+  private:
+    friend class ValueSnapshotRegistry;
+
+    std::atomic<int64_t> m_tag{kEmptyTag};
+    std::atomic<int64_t> m_value{0};
+    std::atomic<bool> m_hasValue{false};
+  };
+
+  ValueSnapshotRegistry() noexcept {
+    for (size_t i = 0; i < Capacity; ++i) {
+      m_freeSlots[i] = static_cast<uint32_t>(Capacity - 1 - i);
+    }
+  }
+
+  ValueSnapshotRegistry(const ValueSnapshotRegistry &) = delete;
+  ValueSnapshotRegistry &operator=(const ValueSnapshotRegistry &) = delete;
+
+  /// <summary>
+  /// Claims a slot for the given tag, or returns the one it already has.
+  /// </summary>
+  /// <returns>The slot, or nullptr when the registry is full</returns>
+  Slot *Register(int64_t tag) noexcept {
+    std::lock_guard<std::mutex> lock{m_writeMutex};
+    auto &index = ActiveIndex();
+
+    // The tag may sit past a tombstone, so the whole chain is probed before one is reused
+    std::optional<size_t> free;
+    for (size_t probe = 0; probe < Capacity; ++probe) {
+      const size_t position = (Hash(tag) + probe) & (Capacity - 1);
+      const int64_t current = index[position].tag.load(std::memory_order_relaxed);
+      if (current == tag) {
+        return &m_slots[index[position].slot.load(std::memory_order_relaxed)];
+      }
+      if (current == kRemovedTag && !free) {
+        free = position;
+      } else if (current == kEmptyTag) {
+        if (!free) {
+          free = position;
+        }
+        break;
+      }
+    }
+    if (!free || m_freeCount == 0) {
+      return nullptr;
+    }
+
+    if (index[*free].tag.load(std::memory_order_relaxed) == kRemovedTag) {
+      --m_tombstones;
+    }
+    const uint32_t slotNumber = m_freeSlots[--m_freeCount];
+    auto &slot = m_slots[slotNumber];
+    // Unregister() cleared the value before freeing the slot, so a new owner never sees stale data
+    slot.m_tag.store(tag, std::memory_order_release);
+    index[*free].slot.store(slotNumber, std::memory_order_relaxed);
+    index[*free].tag.store(tag, std::memory_order_release);
+    return &slot;
+  }
+
+  /// <summary>
+  /// Releases a slot previously returned by Register().
+  /// </summary>
+  void Unregister(Slot *slot) noexcept {
+    if (!slot) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock{m_writeMutex};
+    const int64_t tag = slot->m_tag.load(std::memory_order_relaxed);
+    if (tag == kEmptyTag) {
+      return;
+    }
+    auto &index = ActiveIndex();
+    for (size_t probe = 0; probe < Capacity; ++probe) {
+      auto &entry = index[(Hash(tag) + probe) & (Capacity - 1)];
+      const int64_t current = entry.tag.load(std::memory_order_relaxed);
+      if (current == kEmptyTag) {
+        break;
+      }
+      if (current == tag) {
+        entry.tag.store(kRemovedTag, std::memory_order_release);
+        ++m_tombstones;
+        break;
+      }
+    }
+
+    slot->Clear();
+    slot->m_tag.store(kEmptyTag, std::memory_order_release);
+    m_freeSlots[m_freeCount++] = static_cast<uint32_t>(slot - m_slots.data());
+
+    if (m_tombstones > kMaxTombstones) {
+      RebuildIndex();
+    }
+  }
+
+  /// <summary>
+  /// Reads the last committed value for a view, if the view is live and has committed one.
+  /// </summary>
+  std::optional<int64_t> Read(int64_t tag) const noexcept {
+    for (;;) {
+      const uint64_t generation = m_generation.load(std::memory_order_acquire);
+      const auto value = Find(m_indexes[generation & 1], tag);
+      // Loads in Find() are acquires, so this one cannot move ahead of them
+      if (m_generation.load(std::memory_order_relaxed) == generation) {
+        return value;
+      }
+    }
+  }
+
+  /// <summary>
+  /// Tombstones in the index; bounded by the rebuilds.
+  /// </summary>
+  size_t Tombstones() const noexcept {
+    std::lock_guard<std::mutex> lock{m_writeMutex};
+    return m_tombstones;
+  }
+
+  /// <summary>
+  /// Number of times the index was rebuilt to drop its tombstones.
+  /// </summary>
+  uint64_t Rebuilds() const noexcept {
+    return m_generation.load(std::memory_order_relaxed);
+  }
+
+private:
+  static constexpr int64_t kEmptyTag = 0;
+  static constexpr int64_t kRemovedTag = -1;
+  static constexpr size_t kMaxTombstones = Capacity / 4;
+
+  struct IndexEntry {
+    std::atomic<int64_t> tag{kEmptyTag};
+    std::atomic<uint32_t> slot{0};
+  };
+  using Index = std::array<IndexEntry, Capacity>;
+
+  static size_t Hash(int64_t tag) noexcept {
+    return static_cast<size_t>(static_cast<uint64_t>(tag) * 0x9E3779B97F4A7C15ull >> 16);
+  }
+
+  Index &ActiveIndex() noexcept {
+    return m_indexes[m_generation.load(std::memory_order_relaxed) & 1];
+  }
+
+  std::optional<int64_t> Find(const Index &index, int64_t tag) const noexcept {
+    for (size_t probe = 0; probe < Capacity; ++probe) {
+      const auto &entry = index[(Hash(tag) + probe) & (Capacity - 1)];
+      const int64_t current = entry.tag.load(std::memory_order_acquire);
+      if (current == kEmptyTag) {
+        return std::nullopt;
+      }
+      if (current == tag) {
+        const auto &slot = m_slots[entry.slot.load(std::memory_order_acquire)];
+        if (slot.m_tag.load(std::memory_order_acquire) != tag || !slot.m_hasValue.load(std::memory_order_acquire)) {
+          return std::nullopt;
+        }
+        const int64_t value = slot.m_value.load(std::memory_order_acquire);
+        // The view may have been unmounted while we were reading
+        if (slot.m_tag.load(std::memory_order_acquire) != tag) {
+          return std::nullopt;
+        }
+        return value;
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Copies the live entries into the inactive index, then makes it the active one. Readers
+  // still probing the inactive copy started before the previous rebuild; whatever they see of
+  // this one, they also see that generation change and retry.
+  void RebuildIndex() noexcept {
+    const uint64_t generation = m_generation.load(std::memory_order_relaxed);
+    const auto &current = m_indexes[generation & 1];
+    auto &next = m_indexes[(generation + 1) & 1];
+
+    for (auto &entry : next) {
+      entry.tag.store(kEmptyTag, std::memory_order_release);
+    }
+    for (const auto &entry : current) {
+      const int64_t tag = entry.tag.load(std::memory_order_relaxed);
+      if (tag == kEmptyTag || tag == kRemovedTag) {
+        continue;
+      }
+      for (size_t probe = 0;; ++probe) {
+        auto &target = next[(Hash(tag) + probe) & (Capacity - 1)];
+        if (target.tag.load(std::memory_order_relaxed) == kEmptyTag) {
+          target.slot.store(entry.slot.load(std::memory_order_relaxed), std::memory_order_relaxed);
+          target.tag.store(tag, std::memory_order_release);
+          break;
+        }
+      }
+    }
+    m_generation.store(generation + 1, std::memory_order_release);
+    m_tombstones = 0;
+  }
+
+  std::array<Slot, Capacity> m_slots;
+  // Two copies of the index; the one in use is picked by the parity of the generation
+  std::array<Index, 2> m_indexes;
+  std::atomic<uint64_t> m_generation{0};
+
+  // Writer state
+  mutable std::mutex m_writeMutex;
+  std::array<uint32_t, Capacity> m_freeSlots;
+  size_t m_freeCount{Capacity};
+  size_t m_tombstones{0};
+};
+
+using PickerValueRegistry = ValueSnapshotRegistry<1024>;
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+// Adapters from the interfaces in PickerControls.h to XAML controls and JSValue props.
+// The control adapters are templates so they serve both the system XAML controls of the
+// paper views and the WinUI controls of the Fabric views and imperative components.
+
+#include "PickerControls.h"
+#include "JSValue.h"
+
+#include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Globalization.h>
+
+namespace winrt::DateTimePicker::Helpers {
+
+/// <summary>
+/// Converts a prop received as a JSValue.
+/// </summary>
+inline PickerPropValue PickerPropValueFromJSValue(const winrt::Microsoft::ReactNative::JSValue &value) {
+  using winrt::Microsoft::ReactNative::JSValueType;
+  switch (value.Type()) {
+    case JSValueType::String:
+      return PickerPropValue{value.AsString()};
+    case JSValueType::Boolean:
+      return PickerPropValue{value.AsBoolean()};
+    case JSValueType::Int64:
+      return PickerPropValue{value.AsInt64()};
+    case JSValueType::Double:
+      return PickerPropValue{value.AsDouble()};
+    default:
+      return PickerPropValue{};
+  }
+}
+
+/// <summary>
+/// Reads the props of one update from a JSValueObject.
+/// </summary>
+class JSValuePropReader final : public IPickerPropReader {
+public:
+  explicit JSValuePropReader(const winrt::Microsoft::ReactNative::JSValueObject &props) noexcept : m_props(props) {}
+
+  void ForEach(const Visitor &visitor) const override {
+    for (const auto &[name, value] : m_props) {
+      visitor(name, PickerPropValueFromJSValue(value));
+    }
+  }
+
+private:
+  const winrt::Microsoft::ReactNative::JSValueObject &m_props;
+};
+
+/// <summary>
+/// IDateControl over a CalendarDatePicker.
+/// </summary>
+template <typename TCalendarDatePicker>
+class XamlDateControl final : public IDateControl {
+public:
+  explicit XamlDateControl(TCalendarDatePicker control) noexcept : m_control(std::move(control)) {}
+
+  void Date(std::optional<int64_t> wallSeconds) override {
+    if (wallSeconds) {
+      m_control.Date(DateTimeFromWallSeconds(*wallSeconds));
+    } else {
+      m_control.ClearValue(TCalendarDatePicker::DateProperty());
+    }
+  }
+
+  void MinDate(std::optional<int64_t> wallSeconds) override {
+    if (wallSeconds) {
+      m_control.MinDate(DateTimeFromWallSeconds(*wallSeconds));
+    } else {
+      m_control.ClearValue(TCalendarDatePicker::MinDateProperty());
+    }
+  }
+
+  void MaxDate(std::optional<int64_t> wallSeconds) override {
+    if (wallSeconds) {
+      m_control.MaxDate(DateTimeFromWallSeconds(*wallSeconds));
+    } else {
+      m_control.ClearValue(TCalendarDatePicker::MaxDateProperty());
+    }
+  }
+
+  void DateFormat(const std::optional<PickerText> &format) override {
+    if (format) {
+      m_control.DateFormat(*format);
+    } else {
+      m_control.ClearValue(TCalendarDatePicker::DateFormatProperty());
+    }
+  }
+
+  void DayOfWeekFormat(const std::optional<PickerText> &format) override {
+    if (format) {
+      m_control.DayOfWeekFormat(*format);
+    } else {
+      m_control.ClearValue(TCalendarDatePicker::DayOfWeekFormatProperty());
+    }
+  }
+
+  void FirstDayOfWeek(std::optional<int32_t> dayOfWeek) override {
+    if (dayOfWeek) {
+      m_control.FirstDayOfWeek(static_cast<winrt::Windows::Globalization::DayOfWeek>(*dayOfWeek));
+    } else {
+      m_control.ClearValue(TCalendarDatePicker::FirstDayOfWeekProperty());
+    }
+  }
+
+  void PlaceholderText(const std::optional<PickerText> &text) override {
+    if (text) {
+      m_control.PlaceholderText(*text);
+    } else {
+      m_control.ClearValue(TCalendarDatePicker::PlaceholderTextProperty());
+    }
+  }
+
+  void Name(const PickerText &name) override {
+    m_control.Name(name);
+  }
+
+  /// <summary>
+  /// Wall-clock seconds of a date reported by the control.
+  /// </summary>
+  static int64_t WallSecondsFromDateTime(winrt::Windows::Foundation::DateTime dateTime) noexcept {
+    return static_cast<int64_t>(winrt::clock::to_time_t(dateTime));
+  }
+
+private:
+  static winrt::Windows::Foundation::DateTime DateTimeFromWallSeconds(int64_t wallSeconds) noexcept {
+    return winrt::clock::from_time_t(static_cast<time_t>(wallSeconds));
+  }
+
+  TCalendarDatePicker m_control;
+};
+
+/// <summary>
+/// ITimeControl over a TimePicker.
+/// </summary>
+template <typename TTimePicker>
+class XamlTimeControl final : public ITimeControl {
+public:
+  explicit XamlTimeControl(TTimePicker control) noexcept : m_control(std::move(control)) {}
+
+  void Time(std::optional<int64_t> millisecondsSinceMidnight) override {
+    if (millisecondsSinceMidnight) {
+      m_control.Time(winrt::Windows::Foundation::TimeSpan{*millisecondsSinceMidnight * 10000});
+    } else {
+      m_control.ClearValue(TTimePicker::TimeProperty());
+    }
+  }
+
+  void Is24Hour(std::optional<bool> is24Hour) override {
+    using winrt::Windows::Globalization::ClockIdentifiers;
+    if (is24Hour) {
+      m_control.ClockIdentifier(*is24Hour ? ClockIdentifiers::TwentyFourHour() : ClockIdentifiers::TwelveHour());
+    } else {
+      m_control.ClearValue(TTimePicker::ClockIdentifierProperty());
+    }
+  }
+
+  void MinuteIncrement(std::optional<int32_t> minuteIncrement) override {
+    if (minuteIncrement) {
+      m_control.MinuteIncrement(*minuteIncrement);
+    } else {
+      m_control.ClearValue(TTimePicker::MinuteIncrementProperty());
+    }
+  }
+
+  /// <summary>
+  /// Milliseconds since midnight of a time reported by the control.
+  /// </summary>
+  static int64_t MillisecondsFromTimeSpan(winrt::Windows::Foundation::TimeSpan time) noexcept {
+    // TimeSpan counts 100ns slices
+    return time.count() / 10000;
+  }
+
+private:
+  TTimePicker m_control;
+};
+
+} // namespace winrt::DateTimePicker::Helpers
@@ -1,5 +1,5 @@
 /*
- * This file is auto-generated from DateTimePickerNativeComponent spec file in TypeScript.
+ * This file is auto-generated from DateTimePickerWindowsNativeComponent spec file in TypeScript.
  */
 // clang-format off
 #pragma once
@@ -33,6 +33,8 @@ struct DateTimePickerProps : winrt::implements<DateTimePickerProps, winrt::Micro
        firstDayOfWeek = cloneFromProps->firstDayOfWeek;
        placeholderText = cloneFromProps->placeholderText;
        accessibilityLabel = cloneFromProps->accessibilityLabel;
+       includeFields = cloneFromProps->includeFields;
+       lazy = cloneFromProps->lazy;
      }
   }
 
@@ -67,6 +69,12 @@ struct DateTimePickerProps : winrt::implements<DateTimePickerProps, winrt::Micro
   REACT_FIELD(accessibilityLabel)
   std::optional<std::string> accessibilityLabel;
 
+  REACT_FIELD(includeFields)
+  std::optional<bool> includeFields;
+
+  REACT_FIELD(lazy)
+  std::optional<bool> lazy;
+
   const winrt::Microsoft::ReactNative::ViewProps ViewProps;
 };
 
@@ -74,6 +82,27 @@ REACT_STRUCT(DateTimePicker_OnChange)
 struct DateTimePicker_OnChange {
   REACT_FIELD(newDate)
   int64_t newDate{};
+
+  REACT_FIELD(year)
+  std::optional<int32_t> year;
+
+  REACT_FIELD(month)
+  std::optional<int32_t> month;
+
+  REACT_FIELD(day)
+  std::optional<int32_t> day;
+
+  REACT_FIELD(weekday)
+  std::optional<int32_t> weekday;
+
+  REACT_FIELD(dayOfYear)
+  std::optional<int32_t> dayOfYear;
+
+  REACT_FIELD(isoWeek)
+  std::optional<int32_t> isoWeek;
+
+  REACT_FIELD(valuesSkipped)
+  std::optional<bool> valuesSkipped;
 };
 
 struct DateTimePickerEventEmitter {